@@ -0,0 +1,39 @@
+/*
+*   File: allocCounter.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Debug heap allocation counter. Replaces the global operator new/delete for the whole program.
+*/
+
+#include "allocCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<long> allocationCount(0);
+
+long getAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * Array, nothrow and sized forms all end up here or in operator delete below
+ */
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    void* p = std::malloc(size > 0 ? size : 1);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
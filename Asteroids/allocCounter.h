@@ -0,0 +1,22 @@
+/*
+*   File: allocCounter.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Debug heap allocation counter. Linking allocCounter.cpp replaces the global operator new/delete
+*   with versions that count every allocation, so a run can prove the game loop does not touch the heap.
+*
+*/
+
+#ifndef ALLOCCOUNTER_H
+#define ALLOCCOUNTER_H
+
+/**
+ * Gets how many times operator new has been called since the program started.
+ *
+ * @return Total number of heap allocations
+ */
+long getAllocationCount();
+
+#endif
@@ -0,0 +1,158 @@
+/*
+*   File: batchEnv.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Batch of independent Worlds stepped in parallel. Each environment only writes its own row of the
+*   output buffers, so the threads never need to synchronize inside a step.
+*/
+
+#include "batchEnv.h"
+#include "replay.h"
+#include <cmath>
+
+BatchEnv::BatchEnv(int count, unsigned baseSeed, ThreadPool& pool, const WorldConfig& config)
+    : pool(pool), observations(static_cast<std::size_t>(count) * OBS_SIZE, 0.f), rewards(count, 0.f), dones(count, 0) {
+    worlds.reserve(count);
+    for (int i = 0; i < count; i++) {
+        worlds.emplace_back(new World(baseSeed + static_cast<unsigned>(i), config));
+    }
+
+    for (int i = 0; i < count; i++) {
+        observe(i);
+    }
+}
+
+void BatchEnv::reset() {
+    pool.parallelFor(size(), BATCH_GRAIN, [this](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            worlds[i] -> reset();
+            rewards[i] = 0.f;
+            dones[i] = 0;
+            observe(i);
+        }
+    });
+}
+
+/**
+ * Header checks are the same for every copy, so the first load decides for all of them
+ */
+bool BatchEnv::fork(const unsigned char* data, std::size_t bytes) {
+    if (worlds.empty() || !worlds[0] -> load(data, bytes))
+        return false;
+
+    pool.parallelFor(size(), BATCH_GRAIN, [this, data, bytes](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            if (i > 0) {
+                worlds[i] -> load(data, bytes);
+            }
+            rewards[i] = 0.f;
+            dones[i] = 0;
+            observe(i);
+        }
+    });
+    return true;
+}
+
+void BatchEnv::step(const std::uint8_t* actions) {
+    pool.parallelFor(size(), BATCH_GRAIN, [this, actions](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            World& world = *worlds[i];
+            int scoreBefore = world.getScore();
+
+            world.step(unpackInput(actions[i]));
+
+            rewards[i] = static_cast<float>(world.getScore() - scoreBefore);
+            dones[i] = world.isGameOver() ? 1 : 0;
+
+            if (dones[i]) {
+                world.reset();
+            }
+
+            observe(i);
+        }
+    });
+}
+
+/**
+ * Wrapped offset from a to b along one axis, in [-size/2, size/2]
+ */
+static double wrapDelta(double a, double b, double size) {
+    double d = b - a;
+    if (d > size / 2) d -= size;
+    if (d < -size / 2) d += size;
+    return d;
+}
+
+/**
+ * Fill row env: ship block, then the nearest asteroids by insertion into a small sorted list (no allocation)
+ */
+void BatchEnv::observe(int env) {
+    const World& world = *worlds[env];
+    const ShipState& ship = world.getShip();
+    const AsteroidStore& asteroids = world.getAsteroids();
+    float* row = &observations[static_cast<std::size_t>(env) * OBS_SIZE];
+
+    Point location = ship.location;
+    Point velocity = ship.velocity;
+    double angleRad = ship.angle * 3.14159265 / 180.0;
+
+    row[0] = static_cast<float>(location.x / SCREEN_WIDTH);
+    row[1] = static_cast<float>(location.y / SCREEN_HEIGHT);
+    row[2] = static_cast<float>(velocity.x / MAX_SPEED);
+    row[3] = static_cast<float>(velocity.y / MAX_SPEED);
+    row[4] = static_cast<float>(std::cos(angleRad));
+    row[5] = static_cast<float>(std::sin(angleRad));
+    row[6] = ship.type == SHIP ? 1.f : 0.f;
+    row[7] = ship.invincible ? 1.f : 0.f;
+    row[8] = world.getLives() / 3.f;
+
+    int nearest[OBS_ASTEROIDS];
+    double nearestDist[OBS_ASTEROIDS];
+    int found = 0;
+
+    for (int a = 0; a < asteroids.size(); a++) {
+        double dx = wrapDelta(location.x, asteroids.getX()[a], SCREEN_WIDTH);
+        double dy = wrapDelta(location.y, asteroids.getY()[a], SCREEN_HEIGHT);
+        double dist = dx * dx + dy * dy;
+
+        if (found == OBS_ASTEROIDS && dist >= nearestDist[found - 1])
+            continue;
+
+        int k = found < OBS_ASTEROIDS ? found++ : found - 1;
+        while (k > 0 && nearestDist[k - 1] > dist) {
+            nearest[k] = nearest[k - 1];
+            nearestDist[k] = nearestDist[k - 1];
+            k--;
+        }
+        nearest[k] = a;
+        nearestDist[k] = dist;
+    }
+
+    float* out = row + OBS_SHIP;
+    for (int k = 0; k < OBS_ASTEROIDS; k++, out += OBS_PER_ASTEROID) {
+        if (k >= found) {
+            for (int f = 0; f < OBS_PER_ASTEROID; f++) out[f] = 0.f;
+            continue;
+        }
+
+        int a = nearest[k];
+        Point v = asteroids.getVelocity(a);
+        out[0] = static_cast<float>(wrapDelta(location.x, asteroids.getX()[a], SCREEN_WIDTH) / SCREEN_WIDTH);
+        out[1] = static_cast<float>(wrapDelta(location.y, asteroids.getY()[a], SCREEN_HEIGHT) / SCREEN_HEIGHT);
+        out[2] = static_cast<float>(v.x);
+        out[3] = static_cast<float>(v.y);
+        out[4] = static_cast<float>(asteroids.getRadius(a) / 25.0);
+    }
+}
+
+// ============================================================
+// Getters
+// ============================================================
+
+int BatchEnv::size() const { return static_cast<int>(worlds.size()); }
+const float* BatchEnv::getObservations() const { return observations.data(); }
+const float* BatchEnv::getRewards() const { return rewards.data(); }
+const std::uint8_t* BatchEnv::getDones() const { return dones.data(); }
+const World& BatchEnv::getWorld(int env) const { return *worlds[env]; }
@@ -0,0 +1,106 @@
+/*
+*   File: batchEnv.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Batch API for agents and scripted policies. Holds N independent Worlds, steps them all in lockstep
+*   across a ThreadPool from one array of actions, and writes observations, rewards and done flags into contiguous
+*   buffers (environment i owns row i).
+*
+*/
+
+#ifndef BATCHENV_H
+#define BATCHENV_H
+#include "world.h"
+#include "threadPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Observation layout, all floats:
+//   ship:      x, y (0..1), vx, vy (/ MAX_SPEED), cos, sin of the angle, alive, invincible, lives / 3
+//   asteroids: the OBS_ASTEROIDS nearest by wrapped distance, each dx, dy (/ screen size), vx, vy, radius / 25
+//              (missing asteroids are all zeros)
+const int OBS_SHIP = 9;
+const int OBS_ASTEROIDS = 8;
+const int OBS_PER_ASTEROID = 5;
+const int OBS_SIZE = OBS_SHIP + OBS_ASTEROIDS * OBS_PER_ASTEROID;
+
+// Environments per ThreadPool chunk
+const int BATCH_GRAIN = 16;
+
+class BatchEnv {
+    private:
+
+    std::vector<std::unique_ptr<World>> worlds;
+    ThreadPool& pool;
+
+    std::vector<float> observations;
+    std::vector<float> rewards;
+    std::vector<std::uint8_t> dones;
+
+    void observe(int env);
+
+    public:
+
+    /**
+     * Creates count Worlds; environment i is seeded with baseSeed + i.
+     *
+     * @param count Number of environments
+     * @param baseSeed Seed of environment 0
+     * @param pool Threads to step on (shared, not owned)
+     * @param config Settings for every World
+    */
+    BatchEnv(int count, unsigned baseSeed, ThreadPool& pool, const WorldConfig& config = WorldConfig());
+
+    /**
+     * Restarts every environment and refreshes all observations. Rewards and dones are cleared.
+    */
+    void reset();
+
+    /**
+     * Puts every environment into the same saved state (World::save block), in parallel, so the batch branches from
+     * one position. Rewards and dones are cleared.
+     *
+     * @param data Save block, 8 byte aligned
+     * @param bytes Bytes in the block
+     * @return False, with nothing changed, if the block isn't a readable save
+    */
+    bool fork(const unsigned char* data, std::size_t bytes);
+
+    /**
+     * Steps every environment once, in parallel.
+     * An environment whose game ends this step reports done = 1 and is restarted straight away, so its observation
+     * is already the first one of the next game.
+     *
+     * @param actions One byte per environment, ReplayInputBit flags (see packInput)
+    */
+    void step(const std::uint8_t* actions);
+
+    int size() const;
+
+    /**
+     * @return size() x OBS_SIZE floats, row i belongs to environment i
+    */
+    const float* getObservations() const;
+
+    /**
+     * @return size() score gained during the last step
+    */
+    const float* getRewards() const;
+
+    /**
+     * @return size() flags, 1 where the game ended during the last step
+    */
+    const std::uint8_t* getDones() const;
+
+    /**
+     * @param env Environment index
+     * @return That environment's World, for inspection
+    */
+    const World& getWorld(int env) const;
+
+};
+#endif
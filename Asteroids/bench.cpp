@@ -0,0 +1,995 @@
+/*
+*   File: bench.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Headless benchmarks for the simulation hot paths. Needs no window or display. Results are written
+*   as JSON (stdout, or --out FILE) so runs from different builds can be compared.
+*
+*/
+
+#include "world.h"
+#include "batchEnv.h"
+#include "replay.h"
+#include "collision.h"
+#include "sweepAndPrune.h"
+#include "integrator.h"
+#include "timerWheel.h"
+#include "saveState.h"
+#include "particles.h"
+#include "constants.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ============================================================
+// Harness
+// ============================================================
+
+struct BenchResult {
+    std::string name;
+    long items;        // work items per iteration (objects, pairs, ticks...)
+    long iterations;
+    double seconds;
+};
+
+static std::vector<BenchResult> results;
+static double minSeconds = 0.2;
+
+// Written by every benchmark so the optimizer cannot throw the work away
+static volatile double sink = 0;
+
+// Setup data comes from one fixed stream, so every run benchmarks the same scenes
+static Pcg32 benchRng(42, 0);
+
+/**
+ * Seconds since some fixed point, for measuring intervals.
+ */
+double nowSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Runs body once to warm up, then repeatedly until minSeconds have passed, and records the result.
+ *
+ * @param name Benchmark name, "group/variant/size"
+ * @param items Work items done by one call of body
+ * @param body The code being measured
+ */
+template <typename Body>
+void runBench(const std::string& name, long items, Body body) {
+    body();
+
+    long iterations = 0;
+    double start = nowSeconds();
+    double elapsed = 0;
+
+    do {
+        body();
+        iterations++;
+        elapsed = nowSeconds() - start;
+    } while (elapsed < minSeconds);
+
+    results.push_back({name, items, iterations, elapsed});
+    std::cerr << name << ": " << elapsed * 1e9 / (static_cast<double>(iterations) * items) << " ns/item\n";
+}
+
+/**
+ * Writes every recorded result as one JSON document.
+ */
+void writeJson(std::ostream& out) {
+    out << "{\n";
+    out << "  \"integrator\": \"" << getIntegratorName(getBestIntegrator()) << "\",\n";
+    out << "  \"min_seconds\": " << minSeconds << ",\n";
+    out << "  \"benchmarks\": [\n";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        double totalItems = static_cast<double>(r.iterations) * r.items;
+
+        out << "    {\"name\": \"" << r.name << "\""
+            << ", \"items\": " << r.items
+            << ", \"iterations\": " << r.iterations
+            << ", \"seconds\": " << r.seconds
+            << ", \"ns_per_item\": " << r.seconds * 1e9 / totalItems
+            << ", \"items_per_us\": " << totalItems / (r.seconds * 1e6)
+            << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    out << "  ]\n";
+    out << "}\n";
+}
+
+// ============================================================
+// Setup Helpers
+// ============================================================
+
+/**
+ * Random asteroid, one of the three sizes the game uses.
+ */
+void addRandomAsteroid(AsteroidStore& store) {
+    const double sizes[] = {25.0, 12.5, 6.25};
+    store.add(getRandomLocation(benchRng), getRandomVelocity(benchRng), sizes[benchRng.nextBelow(3)]);
+}
+
+/**
+ * Random photon, moving at full speed in a random direction.
+ */
+void addRandomPhoton(PhotonStore& store) {
+    int i = store.add(getRandomLocation(benchRng), {0.0, 0.0}, 2.0, benchRng.nextBelow(360));
+    store.applyThrust(i, 5.0);
+}
+
+/**
+ * Same scripted pilot the headless simulator uses.
+ */
+InputFrame scriptedInput(long tick, bool gameOver, int fireEvery = 10) {
+    InputFrame input;
+    input.rotateRight = true;
+    input.thrust = (tick % 90) < 30;
+    input.fire = (tick % fireEvery) == 0;
+    input.restart = gameOver;
+    return input;
+}
+
+// ============================================================
+// Random numbers
+// ============================================================
+
+/**
+ * std::rand() % N against Pcg32::nextBelow, drawing spawn-style screen coordinates.
+ */
+void benchRandom() {
+    const int draws = 100000;
+
+    std::srand(42);
+    runBench("random/std_rand_mod", draws, [&]() {
+        unsigned total = 0;
+        for (int i = 0; i < draws; i++) {
+            total += std::rand() % SCREEN_WIDTH;
+        }
+        sink = sink + total;
+    });
+
+    Pcg32 rng(42, STREAM_SPAWN);
+    runBench("random/pcg32_below", draws, [&]() {
+        unsigned total = 0;
+        for (int i = 0; i < draws; i++) {
+            total += rng.nextBelow(SCREEN_WIDTH);
+        }
+        sink = sink + total;
+    });
+}
+
+// ============================================================
+// SpaceObject
+// ============================================================
+
+void benchSpaceObject() {
+    const int n = 1024;
+    std::vector<SpaceObject> objects(n);
+
+    for (int i = 0; i < n; i++) {
+        Point p = getRandomLocation(benchRng);
+        Point v = getRandomVelocity(benchRng);
+        objects[i].setLocation(p.x, p.y);
+        objects[i].setVelocity(v.x, v.y);
+        objects[i].setRadius(i % 2 ? 25.0 : 2.0);
+        objects[i].setAngle(benchRng.nextBelow(360));
+    }
+
+    runBench("objectsIntersect", n, [&]() {
+        int count = 0;
+        for (int i = 0; i < n; i++) {
+            count += objectsIntersect(&objects[i], &objects[(i * 7 + 1) % n]);
+        }
+        sink = sink + count;
+    });
+
+    runBench("SpaceObject::updatePosition", n, [&]() {
+        for (int i = 0; i < n; i++) {
+            objects[i].updatePosition();
+        }
+        sink = sink + objects[0].getLocation().x;
+    });
+
+    runBench("SpaceObject::applyThrust", n, [&]() {
+        for (int i = 0; i < n; i++) {
+            objects[i].applyThrust(0.7f);
+        }
+        sink = sink + objects[0].getVelocity().x;
+    });
+
+    for (int i = 0; i < n; i++) {
+        objects[i].setType(ASTEROID);
+    }
+
+    runBench("SpaceObject::generateAsteroidShape", n, [&]() {
+        for (int i = 0; i < n; i++) {
+            objects[i].generateAsteroidShape(benchRng);
+        }
+    });
+}
+
+// ============================================================
+// Packed position update
+// ============================================================
+
+void benchIntegrators() {
+    const int sizes[] = {1000, 10000, 100000, 1000000};
+
+    for (int n : sizes) {
+        AsteroidStore store(n);
+        for (int i = 0; i < n; i++) {
+            addRandomAsteroid(store);
+        }
+
+        runBench("EntityStore::updatePositions/" + std::to_string(n), n, [&]() {
+            store.updatePositions();
+            sink = sink + store.getX()[0];
+        });
+    }
+
+    for (int k = INTEGRATOR_SCALAR; k <= INTEGRATOR_AVX2; k++) {
+        IntegratorKind kind = static_cast<IntegratorKind>(k);
+        if (!isIntegratorSupported(kind))
+            continue;
+
+        for (int n : sizes) {
+            std::vector<double> x(n), y(n), vx(n), vy(n);
+            for (int i = 0; i < n; i++) {
+                x[i] = benchRng.nextBelow(SCREEN_WIDTH);
+                y[i] = benchRng.nextBelow(SCREEN_HEIGHT);
+                vx[i] = benchRng.nextInt(-300, 300) / 100.0;
+                vy[i] = benchRng.nextInt(-300, 300) / 100.0;
+            }
+
+            runBench(std::string("integrate/") + getIntegratorName(kind) + "/" + std::to_string(n), n, [&]() {
+                integratePositionsWith(kind, x.data(), y.data(), vx.data(), vy.data(), n);
+                sink = sink + x[0];
+            });
+        }
+    }
+}
+
+/**
+ * Every SIMD kernel has to land on exactly the same positions as the scalar one.
+ */
+bool integratorsAgree(int n, int steps) {
+    for (int k = INTEGRATOR_SSE2; k <= INTEGRATOR_AVX2; k++) {
+        IntegratorKind kind = static_cast<IntegratorKind>(k);
+        if (!isIntegratorSupported(kind))
+            continue;
+
+        std::vector<double> sx(n), sy(n), vx(n), vy(n);
+        for (int i = 0; i < n; i++) {
+            sx[i] = benchRng.nextBelow(SCREEN_WIDTH);
+            sy[i] = benchRng.nextBelow(SCREEN_HEIGHT);
+            vx[i] = benchRng.nextInt(-300, 300) / 100.0;
+            vy[i] = benchRng.nextInt(-300, 300) / 100.0;
+        }
+        std::vector<double> x = sx, y = sy;
+
+        for (int s = 0; s < steps; s++) {
+            integratePositionsWith(INTEGRATOR_SCALAR, sx.data(), sy.data(), vx.data(), vy.data(), n);
+            integratePositionsWith(kind, x.data(), y.data(), vx.data(), vy.data(), n);
+        }
+
+        if (sx != x || sy != y) {
+            std::cerr << getIntegratorName(kind) << " does not match scalar\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// One class for everything vs per-kind kernels
+// ============================================================
+
+/**
+ * The same scene two ways: one vector of SpaceObject with asteroids and photons mixed together (every call checks
+ * the type, every photon carries an outline vector and an invincibility timer), and one packed store per kind
+ * moved by its own kernel. Both must end up in the same place.
+ */
+bool benchKernels() {
+    const int sizes[] = {1000, 10000, 100000};
+
+    for (int n : sizes) {
+        std::vector<SpaceObject> objects;
+        objects.reserve(n);
+        AsteroidStore asteroids(n);
+        PhotonStore photons(n);
+
+        // Two asteroids for every photon, interleaved the way spawns and shots arrive
+        for (int i = 0; i < n; i++) {
+            Point p = getRandomLocation(benchRng);
+            Point v = getRandomVelocity(benchRng);
+
+            if (i % 3 == 2) {
+                double angle = benchRng.nextBelow(360);
+                objects.emplace_back(PHOTON_TORPEDO, p, v, 2.0, angle);
+                objects.back().applyThrust(5.0f);
+                photons.add(p, v, 2.0, angle);
+                photons.applyThrust(photons.size() - 1, 5.0f);
+            } else {
+                objects.emplace_back(ASTEROID, p, v, 25.0, 0.0);
+                objects.back().generateAsteroidShape(benchRng);
+                asteroids.add(p, v, 25.0);
+            }
+        }
+
+        for (int step = 0; step < 100; step++) {
+            for (SpaceObject& object : objects) object.updatePosition();
+            asteroids.updatePositions();
+            photons.updatePositions();
+        }
+
+        int a = 0;
+        int p = 0;
+        for (const SpaceObject& object : objects) {
+            bool photon = object.getType() == PHOTON_TORPEDO;
+            Point expected = photon ? photons.getLocation(p++) : asteroids.getLocation(a++);
+
+            if (object.getLocation().x != expected.x || object.getLocation().y != expected.y) {
+                std::cerr << "kernels/" << n << ": per-kind kernels do not match SpaceObject\n";
+                return false;
+            }
+        }
+
+        runBench("update/spaceObject/" + std::to_string(n), n, [&]() {
+            for (SpaceObject& object : objects) object.updatePosition();
+            sink = sink + objects[0].getLocation().x;
+        });
+
+        runBench("update/kernel/" + std::to_string(n), n, [&]() {
+            asteroids.updatePositions();
+            photons.updatePositions();
+            sink = sink + asteroids.getX()[0];
+        });
+    }
+
+    std::cerr << "  bytes per entity: SpaceObject " << sizeof(SpaceObject) << " (+ "
+              << ASTEROID_POINTS * sizeof(sf::Vector2f) << " outline per asteroid), asteroid "
+              << AsteroidStore::getSaveBytes(8, 0) / 8 << ", photon " << PhotonStore::getSaveBytes(8, 0) / 8 << "\n";
+    return true;
+}
+
+// ============================================================
+// Generational handles
+// ============================================================
+
+/**
+ * Handle lookups on a store that has been churned (a third removed, refilled, then shuffled by reorder()).
+ * Every live handle has to find its own entity, and every handle from before a removal has to come back stale.
+ */
+bool benchHandles() {
+    const int n = 100000;
+    AsteroidStore store(n);
+    std::vector<EntityHandle> live, stale;
+
+    for (int i = 0; i < n; i++) {
+        addRandomAsteroid(store);
+    }
+    for (int k = 0; k < n / 3; k++) {
+        int i = benchRng.nextBelow(store.size());
+        stale.push_back(store.getHandle(i));
+        store.remove(i);
+    }
+    while (!store.full()) {
+        addRandomAsteroid(store);
+    }
+
+    for (int i = 0; i < store.size(); i++) {
+        live.push_back(store.getHandle(i));
+    }
+
+    std::vector<int> order(store.size());
+    for (int i = 0; i < store.size(); i++) order[i] = i;
+    for (int i = store.size() - 1; i > 0; i--) std::swap(order[i], order[benchRng.nextBelow(i + 1)]);
+
+    std::vector<double> xBefore(store.getX(), store.getX() + store.size());
+    store.reorder(order.data());
+
+    for (int k = 0; k < store.size(); k++) {
+        int i = store.find(live[k]);
+        if (i < 0 || store.getX()[i] != xBefore[k]) {
+            std::cerr << "handles: a live handle lost its entity\n";
+            return false;
+        }
+    }
+    for (EntityHandle h : stale) {
+        if (store.isAlive(h)) {
+            std::cerr << "handles: a removed entity's handle still resolves\n";
+            return false;
+        }
+    }
+
+    // Random order, so most lookups miss the cache the way a timer firing for any photon would
+    std::vector<EntityHandle> queries(live);
+    for (int i = static_cast<int>(queries.size()) - 1; i > 0; i--) {
+        std::swap(queries[i], queries[benchRng.nextBelow(i + 1)]);
+    }
+
+    runBench("handles/find/" + std::to_string(n), n, [&]() {
+        long total = 0;
+        for (EntityHandle h : queries) total += store.find(h);
+        sink = sink + total;
+    });
+
+    runBench("handles/reorder/" + std::to_string(n), n, [&]() {
+        store.reorder(order.data());
+        sink = sink + store.getX()[0];
+    });
+
+    return true;
+}
+
+// ============================================================
+// Photon vs Asteroid pass
+// ============================================================
+
+/**
+ * The original nested loop: every photon against every asteroid, same claiming rules as findPhotonHits.
+ */
+void findPhotonHitsNaive(const PhotonStore& photons, const AsteroidStore& asteroids,
+                         std::vector<char>& asteroidHit, std::vector<PhotonHit>& hits) {
+    hits.clear();
+
+    for (int p = 0; p < photons.size(); p++) {
+        for (int a = 0; a < asteroids.size(); a++) {
+            if (!asteroidHit[a] && circleTouchesAsteroid(photons.getLocation(p), photons.getRadius(p),
+                                                         asteroids.getLocation(a), asteroids.getRadius(a),
+                                                         asteroids.getShape(a))) {
+                asteroidHit[a] = 1;
+                hits.push_back({p, a});
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Circle-only test against the two-stage outline test, on photon/asteroid pairs close enough to pass a loose
+ * broadphase (within 2 radii), so the outline stage actually runs on a share of them.
+ */
+void benchNarrowphase() {
+    const int pairs = 4096;
+    const double sizes[] = {25.0, 12.5, 6.25};
+
+    std::vector<Point> photonAt(pairs), asteroidAt(pairs);
+    std::vector<double> asteroidRadius(pairs);
+    std::vector<int> asteroidShape(pairs);
+
+    for (int i = 0; i < pairs; i++) {
+        asteroidAt[i] = getRandomLocation(benchRng);
+        asteroidRadius[i] = sizes[benchRng.nextBelow(3)];
+        asteroidShape[i] = benchRng.nextBelow(ASTEROID_SHAPES);
+
+        double angle = benchRng.nextDouble() * 2 * 3.14159265;
+        double dist = benchRng.nextDouble() * 2 * asteroidRadius[i];
+        photonAt[i] = {asteroidAt[i].x + std::cos(angle) * dist, asteroidAt[i].y + std::sin(angle) * dist};
+    }
+
+    int circleHits = 0, outlineHits = 0;
+
+    runBench("narrowphase/circle", pairs, [&]() {
+        circleHits = 0;
+        for (int i = 0; i < pairs; i++) {
+            circleHits += circlesIntersect(photonAt[i], 2.0, asteroidAt[i], asteroidRadius[i]);
+        }
+        sink = sink + circleHits;
+    });
+
+    runBench("narrowphase/outline", pairs, [&]() {
+        outlineHits = 0;
+        for (int i = 0; i < pairs; i++) {
+            outlineHits += circleTouchesAsteroid(photonAt[i], 2.0, asteroidAt[i], asteroidRadius[i], asteroidShape[i]);
+        }
+        sink = sink + outlineHits;
+    });
+
+    std::cerr << "  hits on " << pairs << " pairs: " << circleHits << " circle, " << outlineHits << " outline\n";
+}
+
+/**
+ * Hits must match one for one, in the same order
+ */
+bool sameHits(const std::vector<PhotonHit>& a, const std::vector<PhotonHit>& b) {
+    bool same = a.size() == b.size();
+    for (size_t k = 0; same && k < a.size(); k++) {
+        same = a[k].photon == b[k].photon && a[k].asteroid == b[k].asteroid;
+    }
+    return same;
+}
+
+/**
+ * Grid vs naive vs parallel grid detection at growing populations. Returns false if any two ever disagree.
+ * The parallel pass always gets at least two threads so its merge is checked even on one core.
+ */
+bool benchCollisionPass() {
+    const int asteroidCounts[] = {MAX_ASTEROIDS, 200, 2000, 20000, 100000};
+    int hardware = std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
+    ThreadPool pool(hardware);
+
+    for (int nA : asteroidCounts) {
+        int nP = nA / 2;
+
+        AsteroidStore asteroids(nA);
+        PhotonStore photons(nP);
+        for (int i = 0; i < nA; i++) addRandomAsteroid(asteroids);
+        for (int i = 0; i < nP; i++) addRandomPhoton(photons);
+
+        SpatialGrid grid(GRID_CELL_SIZE);
+        grid.reserve(nA);
+        std::vector<char> asteroidHit(nA, 0);
+        std::vector<PhotonHit> hits, naiveHits, parallelHits;
+        std::vector<PhotonCandidates> candidates(nP);
+        hits.reserve(nP);
+        naiveHits.reserve(nP);
+        parallelHits.reserve(nP);
+
+        std::string size = std::to_string(nA) + "x" + std::to_string(nP);
+
+        runBench("collision/grid/" + size, nP, [&]() {
+            grid.build(asteroids.getX(), asteroids.getY(), asteroids.size());
+            findPhotonHits(photons, asteroids, grid, asteroidHit, hits);
+            for (const PhotonHit& h : hits) asteroidHit[h.asteroid] = 0;
+            sink = sink + hits.size();
+        });
+
+        runBench("collision/parallel/" + size + "/" + std::to_string(hardware) + "threads", nP, [&]() {
+            grid.build(asteroids.getX(), asteroids.getY(), asteroids.size());
+            findPhotonHitsParallel(photons, asteroids, grid, asteroidHit, parallelHits, candidates, pool);
+            for (const PhotonHit& h : parallelHits) asteroidHit[h.asteroid] = 0;
+            sink = sink + parallelHits.size();
+        });
+
+        if (!sameHits(hits, parallelHits)) {
+            std::cerr << "collision/" << size << ": serial and parallel passes disagree\n";
+            return false;
+        }
+
+        if (nA <= 20000) {
+            runBench("collision/naive/" + size, nP, [&]() {
+                findPhotonHitsNaive(photons, asteroids, asteroidHit, naiveHits);
+                for (const PhotonHit& h : naiveHits) asteroidHit[h.asteroid] = 0;
+                sink = sink + naiveHits.size();
+            });
+
+            if (!sameHits(hits, naiveHits)) {
+                std::cerr << "collision/" << size << ": grid and naive passes disagree\n";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Point-sampled vs swept photon pass against a field of the smallest asteroids, at the game's photon speed and at
+ * the per-tick speeds a coarser timestep would give. Reports how many hits each pass finds, the point-sampled
+ * pass falls behind as photons start skipping over asteroids between ticks.
+ */
+void benchSweptCollision() {
+    const int nA = 2000;
+    const int nP = 1000;
+    const double speeds[] = {MAX_SPEED, 12.0, 24.0};
+
+    AsteroidStore asteroids(nA);
+    for (int i = 0; i < nA; i++) {
+        asteroids.add(getRandomLocation(benchRng), getRandomVelocity(benchRng), 6.25);
+    }
+
+    SpatialGrid grid(GRID_CELL_SIZE);
+    grid.reserve(nA);
+    grid.build(asteroids.getX(), asteroids.getY(), asteroids.size());
+
+    std::vector<char> asteroidHit(nA, 0);
+    std::vector<char> photonHit(nP, 0);
+    std::vector<PhotonHit> pointHits, sweptHits;
+    std::vector<SweptHit> events;
+    pointHits.reserve(nP);
+    sweptHits.reserve(nP);
+    events.reserve(nP * 4);
+
+    for (double speed : speeds) {
+        PhotonStore photons(nP);
+        for (int i = 0; i < nP; i++) {
+            double angle = benchRng.nextBelow(360) * 3.14159265 / 180.0;
+            photons.add(getRandomLocation(benchRng), {std::cos(angle) * speed, std::sin(angle) * speed}, 2.0);
+        }
+
+        std::string size = std::to_string(nA) + "x" + std::to_string(nP) + "/speed" + std::to_string(static_cast<int>(speed));
+
+        runBench("collision/point/" + size, nP, [&]() {
+            findPhotonHits(photons, asteroids, grid, asteroidHit, pointHits);
+            for (const PhotonHit& h : pointHits) asteroidHit[h.asteroid] = 0;
+            sink = sink + pointHits.size();
+        });
+
+        runBench("collision/swept/" + size, nP, [&]() {
+            findPhotonHitsSwept(photons, asteroids, grid, asteroidHit, photonHit, sweptHits, events);
+            for (const PhotonHit& h : sweptHits) asteroidHit[h.asteroid] = 0;
+            sink = sink + sweptHits.size();
+        });
+
+        std::cerr << "  hits at speed " << speed << ": " << pointHits.size() << " point-sampled, "
+                  << sweptHits.size() << " swept\n";
+    }
+}
+
+// ============================================================
+// Asteroid vs Asteroid broadphase
+// ============================================================
+
+/**
+ * Every pair of asteroids that touch, found by testing all of them against each other (the O(A^2) baseline).
+ */
+void findTouchingPairsNaive(const AsteroidStore& asteroids, std::vector<std::pair<int, int>>& pairs) {
+    pairs.clear();
+
+    for (int a = 0; a < asteroids.size(); a++) {
+        for (int b = a + 1; b < asteroids.size(); b++) {
+            if (circlesIntersect(asteroids.getLocation(a), asteroids.getRadius(a),
+                                 asteroids.getLocation(b), asteroids.getRadius(b))) {
+                pairs.push_back({a, b});
+            }
+        }
+    }
+}
+
+/**
+ * The same pairs from the sweep, lower index first, sorted so the two lists can be compared.
+ */
+void findTouchingPairsSweep(const AsteroidStore& asteroids, SweepAndPrune& sweep,
+                            std::vector<std::pair<int, int>>& pairs) {
+    pairs.clear();
+
+    sweep.forEachPair([&](int a, int b) {
+        if (circlesIntersect(asteroids.getLocation(a), asteroids.getRadius(a),
+                             asteroids.getLocation(b), asteroids.getRadius(b))) {
+            pairs.push_back({std::min(a, b), std::max(a, b)});
+        }
+    });
+
+    std::sort(pairs.begin(), pairs.end());
+}
+
+/**
+ * Touching asteroid pairs in a moving field: all pairs vs sweep and prune kept up to date tick to tick, and vs the
+ * same sweep rebuilt from scratch every tick (a full sort instead of an insertion sort over last tick's order).
+ * Items are asteroids. Both methods have to find exactly the same pairs, checked over a run of ticks first.
+ */
+bool benchAsteroidPairs() {
+    const int counts[] = {1000, 5000};
+
+    for (int n : counts) {
+        AsteroidStore asteroids(n);
+        for (int i = 0; i < n; i++) {
+            addRandomAsteroid(asteroids);
+        }
+
+        SweepAndPrune sweep;
+        sweep.reserve(n);
+        std::vector<std::pair<int, int>> naivePairs, sweepPairs;
+
+        for (int t = 0; t < 60; t++) {
+            asteroids.updatePositions();
+            sweep.update(asteroids);
+            findTouchingPairsNaive(asteroids, naivePairs);
+            findTouchingPairsSweep(asteroids, sweep, sweepPairs);
+
+            if (naivePairs != sweepPairs) {
+                std::cerr << "sweep and prune: " << sweepPairs.size() << " touching pairs, all pairs found "
+                          << naivePairs.size() << "\n";
+                return false;
+            }
+        }
+
+        long touching = 0;
+
+        runBench("asteroidPairs/allPairs/" + std::to_string(n), n, [&]() {
+            asteroids.updatePositions();
+            findTouchingPairsNaive(asteroids, naivePairs);
+            sink = sink + naivePairs.size();
+        });
+
+        runBench("asteroidPairs/sweepAndPrune/" + std::to_string(n), n, [&]() {
+            asteroids.updatePositions();
+            sweep.update(asteroids);
+            touching = 0;
+            sweep.forEachPair([&](int a, int b) {
+                touching += circlesIntersect(asteroids.getLocation(a), asteroids.getRadius(a),
+                                             asteroids.getLocation(b), asteroids.getRadius(b));
+            });
+            sink = sink + touching;
+        });
+
+        runBench("asteroidPairs/sweepAndPrune/" + std::to_string(n) + "/rebuilt", n, [&]() {
+            asteroids.updatePositions();
+            sweep.clear();
+            sweep.update(asteroids);
+            long rebuiltTouching = 0;
+            sweep.forEachPair([&](int a, int b) {
+                rebuiltTouching += circlesIntersect(asteroids.getLocation(a), asteroids.getRadius(a),
+                                                    asteroids.getLocation(b), asteroids.getRadius(b));
+            });
+            sink = sink + rebuiltTouching;
+        });
+
+        std::cerr << "  " << n << " asteroids: " << touching << " touching pairs\n";
+    }
+
+    return true;
+}
+
+// ============================================================
+// Timers
+// ============================================================
+
+/**
+ * Expiring N objects with lifetimes of up to 1000 ticks, each one replaced as it expires so N stays constant.
+ * Polling ages every object every tick; the wheel only touches the ones that expire. Items are ticks.
+ */
+void benchTimers() {
+    const int counts[] = {1000, 100000};
+    const int ticks = 100;
+
+    for (int n : counts) {
+        std::vector<int> remaining(n);
+        for (int i = 0; i < n; i++) remaining[i] = 1 + benchRng.nextBelow(1000);
+
+        runBench("expiry/poll/" + std::to_string(n), ticks, [&]() {
+            int expired = 0;
+            for (int t = 0; t < ticks; t++) {
+                for (int i = 0; i < n; i++) {
+                    if (--remaining[i] == 0) {
+                        remaining[i] = 1 + benchRng.nextBelow(1000);
+                        expired++;
+                    }
+                }
+            }
+            sink = sink + expired;
+        });
+
+        TimerWheel wheel(n);
+        for (int i = 0; i < n; i++) wheel.schedule(1 + benchRng.nextBelow(1000), 0, i);
+
+        runBench("expiry/wheel/" + std::to_string(n), ticks, [&]() {
+            int expired = 0;
+            for (int t = 0; t < ticks; t++) {
+                wheel.advance([&](int kind, int target) {
+                    wheel.schedule(1 + benchRng.nextBelow(1000), kind, target);
+                    expired++;
+                });
+            }
+            sink = sink + expired;
+        });
+    }
+}
+
+// ============================================================
+// Save / restore
+// ============================================================
+
+/**
+ * Save and load of a busy stress world, against building the same-sized World from scratch (what a restart or a
+ * fresh branch would cost without saves). Also checks that a loaded World saves back to the same bytes.
+ *
+ * @return False if the round trip changed anything
+ */
+bool benchSaveState() {
+    const int n = 10000;
+    World world(42, makeStressConfig(n));
+    for (int t = 0; t < 60; t++) {
+        world.step(scriptedInput(world.getTick(), world.isGameOver(), 1));
+    }
+
+    std::vector<unsigned char> saved;
+    world.save(saved);
+
+    World copy(7, makeStressConfig(n));
+    std::vector<unsigned char> resaved;
+    if (!copy.load(saved.data(), saved.size()) || (copy.save(resaved), resaved != saved)) {
+        std::cerr << "save/load round trip does not match\n";
+        return false;
+    }
+
+    runBench("World::save/" + std::to_string(n), 1, [&]() {
+        world.save(saved);
+        sink = sink + saved.size();
+    });
+
+    runBench("World::load/" + std::to_string(n), 1, [&]() {
+        copy.load(saved.data(), saved.size());
+        sink = sink + copy.getTick();
+    });
+
+    runBench("World::construct/" + std::to_string(n), 1, [&]() {
+        World fresh(42, makeStressConfig(n));
+        sink = sink + fresh.getAsteroids().size();
+    });
+
+    return true;
+}
+
+// ============================================================
+// Particles
+// ============================================================
+
+/**
+ * Emitting one big asteroid's debris, then the per-frame update and batch build at growing particle counts.
+ * Steps are tiny so nothing dies while it is being measured.
+ */
+void benchParticles() {
+    const int perBreak = PARTICLES_PER_BREAK + 25 * PARTICLES_PER_BREAK_RADIUS;
+    ParticleSystem burst;
+
+    runBench("particles/emit", perBreak, [&]() {
+        burst.emit(400.f, 300.f, 30.f, 0.f, 25.f, perBreak, 90.f, sf::Color(150, 140, 125));
+    });
+
+    const int counts[] = {10000, PARTICLE_CAPACITY};
+    for (int n : counts) {
+        ParticleSystem particles;
+        particles.emit(400.f, 300.f, 0.f, 0.f, 200.f, n, 300.f, sf::Color::White);
+
+        runBench("particles/update/" + std::to_string(n), n, [&]() {
+            particles.update(1e-6f);
+        });
+
+        runBench("particles/build/" + std::to_string(n), n, [&]() {
+            particles.build();
+            sink = sink + particles.getLiveCount();
+        });
+    }
+}
+
+// ============================================================
+// Whole tick
+// ============================================================
+
+void benchWholeTick() {
+    World world(42);
+    const int ticks = 1000;
+
+    runBench("World::step", ticks, [&]() {
+        for (int t = 0; t < ticks; t++) {
+            world.step(scriptedInput(world.getTick(), world.isGameOver()));
+        }
+        sink = sink + world.getScore();
+    });
+}
+
+/**
+ * Sustained ticks in stress mode (rapid fire 16-way fan, invulnerable ship) at growing asteroid counts.
+ * The same World keeps running between iterations, so splits and growth are part of the measurement.
+ */
+void benchStressTick() {
+    const int asteroidCounts[] = {1000, 10000, 100000};
+
+    for (int n : asteroidCounts) {
+        for (bool sorted : {true, false}) {
+            WorldConfig config = makeStressConfig(n);
+            config.asteroidSortInterval = sorted ? ASTEROID_SORT_INTERVAL : 0;
+
+            World world(42, config);
+            const int ticks = 10;
+
+            runBench("World::step/stress/" + std::to_string(n) + (sorted ? "" : "/unsorted"), ticks, [&]() {
+                for (int t = 0; t < ticks; t++) {
+                    world.step(scriptedInput(world.getTick(), world.isGameOver(), 1));
+                }
+                sink = sink + world.getAsteroids().size();
+            });
+        }
+    }
+}
+
+/**
+ * Stress mode with asteroids bouncing off each other, at counts where they crowd the screen.
+ */
+void benchBounceTick() {
+    const int asteroidCounts[] = {1000, 5000};
+
+    for (int n : asteroidCounts) {
+        WorldConfig config = makeStressConfig(n);
+        config.asteroidBounce = true;
+
+        World world(42, config);
+        const int ticks = 10;
+
+        runBench("World::step/stress/" + std::to_string(n) + "/bounce", ticks, [&]() {
+            for (int t = 0; t < ticks; t++) {
+                world.step(scriptedInput(world.getTick(), world.isGameOver(), 1));
+            }
+            sink = sink + world.getAsteroids().size();
+        });
+    }
+}
+
+/**
+ * BatchEnv throughput with one thread and with every hardware thread, to show how it scales.
+ */
+void benchBatchEnv() {
+    const int envs = 256;
+    int hardware = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    std::vector<std::uint8_t> actions(envs);
+    for (int i = 0; i < envs; i++) {
+        actions[i] = static_cast<std::uint8_t>(INPUT_ROTATE_RIGHT | (i % 3 == 0 ? INPUT_FIRE : 0));
+    }
+
+    for (int threads : {1, hardware}) {
+        ThreadPool pool(threads);
+        BatchEnv batch(envs, 42, pool);
+
+        runBench("BatchEnv::step/" + std::to_string(envs) + "envs/" + std::to_string(threads) + "threads", envs,
+                 [&]() {
+            batch.step(actions.data());
+            sink = sink + batch.getRewards()[0];
+        });
+
+        // Only one thread available, the second run would repeat the first
+        if (hardware == 1)
+            break;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const char* outPath = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            minSeconds = std::atof(argv[++i]);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--out FILE] [--min-time SECONDS]\n";
+            return 1;
+        }
+    }
+
+    if (!integratorsAgree(1003, 1000))
+        return 1;
+
+    benchRandom();
+    benchSpaceObject();
+    benchIntegrators();
+    if (!benchKernels())
+        return 1;
+    if (!benchHandles())
+        return 1;
+    benchNarrowphase();
+    if (!benchCollisionPass())
+        return 1;
+    benchSweptCollision();
+    if (!benchAsteroidPairs())
+        return 1;
+    benchTimers();
+    if (!benchSaveState())
+        return 1;
+    benchParticles();
+    benchWholeTick();
+    benchStressTick();
+    benchBounceTick();
+    benchBatchEnv();
+
+    if (outPath != nullptr) {
+        std::ofstream out(outPath);
+        writeJson(out);
+    } else {
+        writeJson(std::cout);
+    }
+
+    return 0;
+}
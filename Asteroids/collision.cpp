@@ -0,0 +1,372 @@
+/*
+*   File: collision.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Collision tests for the Asteroids clone.
+*/
+
+#include "collision.h"
+#include "constants.h"
+#include "shapeLibrary.h"
+#include <algorithm>
+#include <cmath>
+
+// ============================================================
+// Part 2 Required Collision Function (NOT a class member)
+// ============================================================
+
+/**
+ * Radius based intersection test
+ */
+bool objectsIntersect(const SpaceObject* a, const SpaceObject* b) {
+    return circlesIntersect(a -> getLocation(), a -> getRadius(),
+                            b -> getLocation(), b -> getRadius());
+}
+
+/**
+ * Offset from b to a the shortest way around the screen wrap
+ */
+static Point wrappedDelta(Point pa, Point pb) {
+    double dx = pa.x - pb.x;
+    double dy = pa.y - pb.y;
+
+    if (dx > SCREEN_WIDTH / 2.0) dx -= SCREEN_WIDTH;
+    if (dx < -SCREEN_WIDTH / 2.0) dx += SCREEN_WIDTH;
+    if (dy > SCREEN_HEIGHT / 2.0) dy -= SCREEN_HEIGHT;
+    if (dy < -SCREEN_HEIGHT / 2.0) dy += SCREEN_HEIGHT;
+
+    return {dx, dy};
+}
+
+bool circlesIntersect(Point pa, double ra, Point pb, double rb) {
+    Point d = wrappedDelta(pa, pb);
+
+    double distSq = d.x * d.x + d.y * d.y;
+    double radSum = ra + rb;
+
+    return distSq <= (radSum * radSum);
+}
+
+bool circleTouchesAsteroid(Point pc, double rc, Point pa, double ra, int shape) {
+    const ShapeLibrary& shapes = getShapeLibrary();
+    Point d = wrappedDelta(pc, pa);
+
+    // Stage 1: bounding circle of the outline
+    double reach = ra * shapes.getOuterRadius(shape) + rc;
+    if (d.x * d.x + d.y * d.y > reach * reach)
+        return false;
+
+    // Stage 2: the outline itself, in its unit space
+    double scale = 1.0 / ra;
+    return shapes.touchesCircle(shape, d.x * scale, d.y * scale, rc * scale);
+}
+
+/**
+ * Rewinds both circles to the start of the tick and solves |d0 + t * w| = ra + rb for the first t in [0, 1],
+ * where d0 is the starting offset and w the relative velocity.
+ */
+bool sweptCirclesHit(Point pa, Point va, double ra, Point pb, Point vb, double rb, double& toi) {
+    Point d0 = wrappedDelta({pa.x - va.x, pa.y - va.y}, {pb.x - vb.x, pb.y - vb.y});
+    double wx = va.x - vb.x;
+    double wy = va.y - vb.y;
+    double radSum = ra + rb;
+
+    double c = d0.x * d0.x + d0.y * d0.y - radSum * radSum;
+
+    // Already touching when the tick started
+    if (c <= 0) {
+        toi = 0;
+        return true;
+    }
+
+    double a = wx * wx + wy * wy;
+    double b = d0.x * wx + d0.y * wy;
+
+    // Not moving relative to each other, or moving apart
+    if (a == 0 || b >= 0)
+        return false;
+
+    double disc = b * b - a * c;
+    if (disc < 0)
+        return false;
+
+    double t = (-b - std::sqrt(disc)) / a;
+    if (t > 1)
+        return false;
+
+    toi = t;
+    return true;
+}
+
+/**
+ * Both stages from the start of the tick, relative to the asteroid; the outline sweep picks up where the bounding
+ * circle was first reached
+ */
+bool sweptCircleHitsAsteroid(Point pc, Point vc, double rc, Point pa, Point va, double ra, int shape, double& toi) {
+    const ShapeLibrary& shapes = getShapeLibrary();
+
+    // Stage 1: swept against the outline's bounding circle
+    double enter;
+    if (!sweptCirclesHit(pc, vc, rc, pa, va, ra * shapes.getOuterRadius(shape), enter))
+        return false;
+
+    // Stage 2: the outline itself, in its unit space, from the moment the bounding circle was reached
+    Point d0 = wrappedDelta({pc.x - vc.x, pc.y - vc.y}, {pa.x - va.x, pa.y - va.y});
+    double wx = vc.x - va.x;
+    double wy = vc.y - va.y;
+    double scale = 1.0 / ra;
+    double rest = 1 - enter;
+    double t;
+
+    if (!shapes.sweepCircle(shape, (d0.x + enter * wx) * scale, (d0.y + enter * wy) * scale,
+                            rest * wx * scale, rest * wy * scale, rc * scale, t))
+        return false;
+
+    toi = enter + rest * t;
+    return true;
+}
+
+// ============================================================
+// Broadphase passes
+// ============================================================
+
+void findPhotonHits(const PhotonStore& photons, const AsteroidStore& asteroids, const SpatialGrid& grid,
+                    std::vector<char>& asteroidHit, std::vector<PhotonHit>& hits) {
+    const double* ax = asteroids.getX();
+    const double* ay = asteroids.getY();
+    const double* ar = asteroids.getRadii();
+    const unsigned char* shape = asteroids.getShapes();
+
+    hits.clear();
+
+    for (int p = 0; p < photons.size(); p++) {
+
+        Point photonLocation = photons.getLocation(p);
+        double photonRadius = photons.getRadius(p);
+        int first = -1;
+
+        grid.forEachNear(photonLocation.x, photonLocation.y, [&](int a) {
+            if ((first < 0 || a < first) && !asteroidHit[a]
+                && circleTouchesAsteroid(photonLocation, photonRadius, {ax[a], ay[a]}, ar[a], shape[a])) {
+                first = a;
+            }
+        });
+
+        if (first >= 0) {
+            asteroidHit[first] = 1;
+            hits.push_back({p, first});
+        }
+    }
+}
+
+/**
+ * Stage 1: keep the PHOTON_CANDIDATES lowest touching indices, sorted by insertion
+ */
+static void gatherCandidates(const PhotonStore& photons, const AsteroidStore& asteroids, const SpatialGrid& grid,
+                             int begin, int end, PhotonCandidates* out) {
+    const double* ax = asteroids.getX();
+    const double* ay = asteroids.getY();
+    const double* ar = asteroids.getRadii();
+    const unsigned char* shape = asteroids.getShapes();
+
+    for (int p = begin; p < end; p++) {
+        Point photonLocation = photons.getLocation(p);
+        double photonRadius = photons.getRadius(p);
+        PhotonCandidates& c = out[p];
+        c.count = 0;
+        c.overflow = false;
+
+        grid.forEachNear(photonLocation.x, photonLocation.y, [&](int a) {
+            bool full = c.count == PHOTON_CANDIDATES;
+
+            // Already full and already overflowed, a higher index can't change anything
+            if (full && c.overflow && a > c.asteroid[PHOTON_CANDIDATES - 1])
+                return;
+            if (!circleTouchesAsteroid(photonLocation, photonRadius, {ax[a], ay[a]}, ar[a], shape[a]))
+                return;
+
+            if (full) {
+                c.overflow = true;
+                if (a > c.asteroid[PHOTON_CANDIDATES - 1])
+                    return;
+                c.count--;
+            }
+
+            int k = c.count++;
+            while (k > 0 && c.asteroid[k - 1] > a) {
+                c.asteroid[k] = c.asteroid[k - 1];
+                k--;
+            }
+            c.asteroid[k] = a;
+        });
+    }
+}
+
+void findPhotonHitsParallel(const PhotonStore& photons, const AsteroidStore& asteroids, const SpatialGrid& grid,
+                            std::vector<char>& asteroidHit, std::vector<PhotonHit>& hits,
+                            std::vector<PhotonCandidates>& candidates, ThreadPool& pool) {
+    const double* ax = asteroids.getX();
+    const double* ay = asteroids.getY();
+    const double* ar = asteroids.getRadii();
+    const unsigned char* shape = asteroids.getShapes();
+    PhotonCandidates* out = candidates.data();
+
+    pool.parallelFor(photons.size(), COLLISION_GRAIN, [&](int begin, int end) {
+        gatherCandidates(photons, asteroids, grid, begin, end, out);
+    });
+
+    // Stage 2: canonical order, identical to findPhotonHits
+    hits.clear();
+
+    for (int p = 0; p < photons.size(); p++) {
+        const PhotonCandidates& c = out[p];
+        int first = -1;
+
+        for (int k = 0; k < c.count && first < 0; k++) {
+            if (!asteroidHit[c.asteroid[k]]) {
+                first = c.asteroid[k];
+            }
+        }
+
+        // Every kept candidate was taken, but there were more: fall back to the full serial search
+        if (first < 0 && c.overflow) {
+            Point photonLocation = photons.getLocation(p);
+            double photonRadius = photons.getRadius(p);
+
+            grid.forEachNear(photonLocation.x, photonLocation.y, [&](int a) {
+                if ((first < 0 || a < first) && !asteroidHit[a]
+                    && circleTouchesAsteroid(photonLocation, photonRadius, {ax[a], ay[a]}, ar[a], shape[a])) {
+                    first = a;
+                }
+            });
+        }
+
+        if (first >= 0) {
+            asteroidHit[first] = 1;
+            hits.push_back({p, first});
+        }
+    }
+}
+
+/**
+ * Grid query at the middle of the photon's sweep, so both ends are covered for any sweep up to half a cell
+ */
+void findPhotonHitsSwept(const PhotonStore& photons, const AsteroidStore& asteroids, const SpatialGrid& grid,
+                         std::vector<char>& asteroidHit, std::vector<char>& photonHit,
+                         std::vector<PhotonHit>& hits, std::vector<SweptHit>& events) {
+    const double* ar = asteroids.getRadii();
+    const unsigned char* shape = asteroids.getShapes();
+
+    events.clear();
+
+    for (int p = 0; p < photons.size(); p++) {
+        Point photonLocation = photons.getLocation(p);
+        Point photonVelocity = photons.getVelocity(p);
+        double photonRadius = photons.getRadius(p);
+
+        grid.forEachNear(photonLocation.x - photonVelocity.x / 2, photonLocation.y - photonVelocity.y / 2, [&](int a) {
+            double toi;
+            if (sweptCircleHitsAsteroid(photonLocation, photonVelocity, photonRadius,
+                                        asteroids.getLocation(a), asteroids.getVelocity(a), ar[a], shape[a], toi)) {
+                events.push_back({toi, p, a});
+            }
+        });
+    }
+
+    // Earliest contact first; ties go to the lower photon, then the lower asteroid, like the point-sample pass
+    std::sort(events.begin(), events.end(), [](const SweptHit& x, const SweptHit& y) {
+        if (x.toi != y.toi) return x.toi < y.toi;
+        if (x.photon != y.photon) return x.photon < y.photon;
+        return x.asteroid < y.asteroid;
+    });
+
+    hits.clear();
+
+    for (const SweptHit& e : events) {
+        if (photonHit[e.photon] || asteroidHit[e.asteroid])
+            continue;
+
+        photonHit[e.photon] = 1;
+        asteroidHit[e.asteroid] = 1;
+        hits.push_back({e.photon, e.asteroid});
+    }
+
+    // Callers remove photons from the back of hits, so hand them back in photon order
+    std::sort(hits.begin(), hits.end(), [](const PhotonHit& x, const PhotonHit& y) {
+        return x.photon < y.photon;
+    });
+
+    for (const PhotonHit& h : hits) {
+        photonHit[h.photon] = 0;
+    }
+}
+
+bool sweepsIntoAnyAsteroid(Point location, Point velocity, double radius,
+                           const AsteroidStore& asteroids, const SpatialGrid& grid) {
+    const double* ar = asteroids.getRadii();
+    const unsigned char* shape = asteroids.getShapes();
+    bool hit = false;
+
+    grid.forEachNear(location.x - velocity.x / 2, location.y - velocity.y / 2, [&](int a) {
+        double toi;
+        if (!hit && sweptCircleHitsAsteroid(location, velocity, radius,
+                                            asteroids.getLocation(a), asteroids.getVelocity(a), ar[a], shape[a], toi)) {
+            hit = true;
+        }
+    });
+
+    return hit;
+}
+
+bool touchesAnyAsteroid(Point location, double radius, const AsteroidStore& asteroids, const SpatialGrid& grid) {
+    const double* ax = asteroids.getX();
+    const double* ay = asteroids.getY();
+    const double* ar = asteroids.getRadii();
+    const unsigned char* shape = asteroids.getShapes();
+
+    bool hit = false;
+
+    grid.forEachNear(location.x, location.y, [&](int a) {
+        if (!hit && circleTouchesAsteroid(location, radius, {ax[a], ay[a]}, ar[a], shape[a])) {
+            hit = true;
+        }
+    });
+
+    return hit;
+}
+
+// ============================================================
+// Asteroid bounces
+// ============================================================
+
+/**
+ * Impulse along the contact normal with restitution 1. With n = d / |d| and closing speed vn = (vb - va).n, a picks
+ * up -2 * vn * mb / (ma + mb) along n (b the same with ma, the other way). Written in terms of d and |d|^2 it needs
+ * no square root, and the test for separating comes before anything is divided.
+ */
+bool bounceCircles(Point pa, Point& va, double ra, Point pb, Point& vb, double rb) {
+    Point d = wrappedDelta(pb, pa);
+
+    double distSq = d.x * d.x + d.y * d.y;
+    double radSum = ra + rb;
+
+    if (distSq > radSum * radSum || distSq == 0)
+        return false;
+
+    // Closing speed along d (times |d|), negative when they approach
+    double closing = (vb.x - va.x) * d.x + (vb.y - va.y) * d.y;
+    if (closing >= 0)
+        return false;
+
+    double massA = ra * ra;
+    double massB = rb * rb;
+    double s = 2.0 * closing / (distSq * (massA + massB));
+
+    va.x += s * massB * d.x;
+    va.y += s * massB * d.y;
+    vb.x -= s * massA * d.x;
+    vb.y -= s * massA * d.y;
+    return true;
+}
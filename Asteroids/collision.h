@@ -0,0 +1,211 @@
+/*
+*   File: collision.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Collision tests for the Asteroids clone. The radius test itself, plus the broadphase-driven passes
+*   that decide which photons hit which asteroids and whether the ship touches anything.
+*
+*/
+
+#ifndef COLLISION_H
+#define COLLISION_H
+#include "spaceObject.h"
+#include "entityStore.h"
+#include "spatialGrid.h"
+#include "threadPool.h"
+#include <vector>
+
+/**
+ * A photon that hit an asteroid this tick.
+ */
+struct PhotonHit {
+    int photon;
+    int asteroid;
+};
+
+/**
+ * Determines whether two SpaceObjects intersect on screen.
+ * Distances are measured across the screen wrap, so objects touching over an edge collide.
+ *
+ * @param a Pointer to first SpaceObject
+ * @param b Pointer to second SpaceObject
+ * @return true if distance between centers <= sum of radii
+ */
+bool objectsIntersect(const SpaceObject* a, const SpaceObject* b);
+
+/**
+ * Same wrapped radius test as objectsIntersect, for entities that live in an EntityStore.
+ *
+ * @param pa Center of the first circle
+ * @param ra Radius of the first circle
+ * @param pb Center of the second circle
+ * @param rb Radius of the second circle
+ * @return true if distance between centers <= sum of radii
+ */
+bool circlesIntersect(Point pa, double ra, Point pb, double rb);
+
+/**
+ * Two-stage test of a circle against an asteroid's actual outline: the outline's bounding circle first, then the
+ * exact edge test from ShapeLibrary. Wraps like circlesIntersect.
+ *
+ * @param pc Center of the circle
+ * @param rc Radius of the circle
+ * @param pa Center of the asteroid
+ * @param ra Radius of the asteroid (the outline's scale)
+ * @param shape Asteroid's outline in the shape library
+ * @return true if the circle touches the outline or anything inside it
+ */
+bool circleTouchesAsteroid(Point pc, double rc, Point pa, double ra, int shape);
+
+/**
+ * Continuous version of circlesIntersect. Both circles moved in a straight line by their velocity during the
+ * tick that just ended, so a small fast circle can't skip over another between two samples.
+ *
+ * @param pa End-of-tick center of the first circle
+ * @param va Displacement of the first circle this tick
+ * @param ra Radius of the first circle
+ * @param pb End-of-tick center of the second circle
+ * @param vb Displacement of the second circle this tick
+ * @param rb Radius of the second circle
+ * @param toi Set on a hit: fraction of the tick (0 to 1) when they first touched
+ * @return true if they touched at any point during the tick
+ */
+bool sweptCirclesHit(Point pa, Point va, double ra, Point pb, Point vb, double rb, double& toi);
+
+/**
+ * Continuous version of circleTouchesAsteroid, with both moving as in sweptCirclesHit: the swept bounding circle
+ * of the outline first, then ShapeLibrary::sweepCircle against the outline itself from the moment that circle
+ * was reached.
+ *
+ * @param pc End-of-tick center of the circle
+ * @param vc Displacement of the circle this tick
+ * @param rc Radius of the circle
+ * @param pa End-of-tick center of the asteroid
+ * @param va Displacement of the asteroid this tick
+ * @param ra Radius of the asteroid (the outline's scale)
+ * @param shape Asteroid's outline in the shape library
+ * @param toi Set on a hit: fraction of the tick (0 to 1) when the circle first touched the outline
+ * @return true if the circle touched the outline or anything inside it at any point during the tick
+ */
+bool sweptCircleHitsAsteroid(Point pc, Point vc, double rc, Point pa, Point va, double ra, int shape, double& toi);
+
+/**
+ * A photon/asteroid contact found by the swept pass, with its time of impact.
+ */
+struct SweptHit {
+    double toi;
+    int photon;
+    int asteroid;
+};
+
+/**
+ * Matches photons to asteroids for one tick. Photons go in index order and each one claims the lowest
+ * indexed asteroid whose outline it touches that no earlier photon claimed.
+ *
+ * @param photons Live photons
+ * @param asteroids Live asteroids, already built into grid
+ * @param grid Asteroid broadphase
+ * @param asteroidHit One flag per asteroid, all 0 on entry; claimed asteroids are set to 1
+ * @param hits Cleared, then filled with one entry per photon that hit something, in photon order
+ */
+void findPhotonHits(const PhotonStore& photons, const AsteroidStore& asteroids, const SpatialGrid& grid,
+                    std::vector<char>& asteroidHit, std::vector<PhotonHit>& hits);
+
+// ===================== Parallel photon pass ===============================================
+
+// Lowest indexed asteroids remembered per photon during the parallel gather
+const int PHOTON_CANDIDATES = 8;
+
+// Photons per ThreadPool chunk in the gather
+const int COLLISION_GRAIN = 64;
+
+/**
+ * What one photon touches, found without looking at any other photon.
+ */
+struct PhotonCandidates {
+    int count;                             // asteroids kept, at most PHOTON_CANDIDATES
+    int asteroid[PHOTON_CANDIDATES];       // the lowest indexed asteroids it touches, ascending
+    bool overflow;                         // it touches more than were kept
+};
+
+/**
+ * Same result as findPhotonHits, in two stages:
+ *   1) gather (parallel): every photon records the lowest indexed asteroids it touches; nothing is shared
+ *   2) resolve (serial, photon order): each photon claims its first unclaimed candidate, so the first photon
+ *      still wins. A photon whose candidates were all claimed but that overflowed rescans like the serial pass.
+ *
+ * @param photons Live photons
+ * @param asteroids Live asteroids, already built into grid
+ * @param grid Asteroid broadphase
+ * @param asteroidHit One flag per asteroid, all 0 on entry; claimed asteroids are set to 1
+ * @param hits Cleared, then filled with one entry per photon that hit something, in photon order
+ * @param candidates Scratch space, at least photons.size() entries
+ * @param pool Threads for the gather
+ */
+void findPhotonHitsParallel(const PhotonStore& photons, const AsteroidStore& asteroids, const SpatialGrid& grid,
+                            std::vector<char>& asteroidHit, std::vector<PhotonHit>& hits,
+                            std::vector<PhotonCandidates>& candidates, ThreadPool& pool);
+
+// ===================== Continuous pass ====================================================
+
+/**
+ * Swept version of findPhotonHits. Every photon whose path touched an asteroid's outline during the tick becomes
+ * an event, and events are claimed in time-of-impact order, so the photon that got there first wins.
+ * Sweeps up to half a grid cell per tick are covered.
+ *
+ * @param photons Live photons
+ * @param asteroids Live asteroids, already built into grid
+ * @param grid Asteroid broadphase
+ * @param asteroidHit One flag per asteroid, all 0 on entry; claimed asteroids are set to 1
+ * @param photonHit One flag per photon, all 0 on entry and on return
+ * @param hits Cleared, then filled with one entry per photon that hit something, in photon order
+ * @param events Scratch space for every contact found
+ */
+void findPhotonHitsSwept(const PhotonStore& photons, const AsteroidStore& asteroids, const SpatialGrid& grid,
+                         std::vector<char>& asteroidHit, std::vector<char>& photonHit,
+                         std::vector<PhotonHit>& hits, std::vector<SweptHit>& events);
+
+/**
+ * Swept version of touchesAnyAsteroid, against the same outlines.
+ *
+ * @param location End-of-tick center of the circle
+ * @param velocity Displacement of the circle this tick
+ * @param radius Radius of the circle
+ * @param asteroids Live asteroids, already built into grid
+ * @param grid Asteroid broadphase
+ * @return true if the circle touched at least one asteroid during the tick
+ */
+bool sweepsIntoAnyAsteroid(Point location, Point velocity, double radius,
+                           const AsteroidStore& asteroids, const SpatialGrid& grid);
+
+/**
+ * Checks a circle against every nearby asteroid.
+ *
+ * @param location Center of the circle
+ * @param radius Radius of the circle
+ * @param asteroids Live asteroids, already built into grid
+ * @param grid Asteroid broadphase
+ * @return true if the circle touches at least one asteroid
+ */
+bool touchesAnyAsteroid(Point location, double radius, const AsteroidStore& asteroids, const SpatialGrid& grid);
+
+// ===================== Asteroid bounces ===================================================
+
+/**
+ * Elastic collision between two circles with mass proportional to radius squared. If they touch (wrapped like
+ * circlesIntersect) and are moving toward each other, swaps their momentum along the line between the centers;
+ * circles that are already separating, or exactly on top of each other, are left alone.
+ *
+ * @param pa Center of the first circle
+ * @param va Velocity of the first circle, changed on a bounce
+ * @param ra Radius of the first circle
+ * @param pb Center of the second circle
+ * @param vb Velocity of the second circle, changed on a bounce
+ * @param rb Radius of the second circle
+ * @return true if they bounced
+ */
+bool bounceCircles(Point pa, Point& va, double ra, Point pb, Point& vb, double rb);
+
+#endif
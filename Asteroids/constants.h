@@ -19,7 +19,33 @@ const double THRUST = 0.1;
 const double DRAG = 0.99;
 const int PHOTON_LIFESPAN = 100;
 
+// Ship size, how long it stays invincible after a respawn, and its explosion (grows this much per tick, then gone)
+const double SHIP_RADIUS = 20.0;
+const int SHIP_INVINCIBLE_TICKS = 180;
+const int SHIP_EXPLOSION_TICKS = 25;
+const double SHIP_EXPLOSION_GROWTH = 0.8;
+
+// Cap the speed to avoid going mach jesus off the screen into an asteroid.
+const double MAX_SPEED = 3.0;
+
+// Number of points around an asteroid outline, and how many different outlines there are
+const int ASTEROID_POINTS = 12;
+const int ASTEROID_SHAPES = 16;
+
+// Broadphase cell size, must cover the biggest asteroid outline (1.2 x radius) plus the ship radius
+const double GRID_CELL_SIZE = 50.0;
+
+// Fixed simulation rate, the sim thread steps the World this many times per second
+const int TICK_RATE = 60;
+
+// Default starting capacities (WorldConfig). Asteroids grow past this, torpedos in flight are capped by it.
 const int MAX_ASTEROIDS = 20;
 const int MAX_PHOTONS = 10;
 
+// Stress mode sorts the asteroids by grid cell this often (ticks), so neighbours stay close together in memory
+const int ASTEROID_SORT_INTERVAL = 30;
+
+// Photons in flight before World hands the photon collision pass to its thread pool
+const int PARALLEL_PHOTON_THRESHOLD = 256;
+
 #endif
@@ -0,0 +1,346 @@
+/*
+*   File: entityStore.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Structure-of-arrays storage for asteroids and photons. Updates are linear sweeps over packed arrays
+*   instead of chasing one heap allocated SpaceObject per entity. Fields a kind doesn't have are compiled out with
+*   if constexpr, and the two stores the World uses are instantiated at the bottom. Handles are a slot map kept next
+*   to the packed range: adding takes the most recently freed slot, removing swaps slots the same way it swaps data.
+*/
+
+#include "entityStore.h"
+#include "integrator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+/**
+ * Allocate every array once
+ */
+template <typename Kind>
+EntityStore<Kind>::EntityStore(int capacity, bool growable) {
+    count = 0;
+    cap = 0;
+    this->growable = growable;
+
+    reserve(capacity);
+}
+
+/**
+ * Every array to exactly newCapacity entries, the slot map included (its contents are up to the caller)
+ */
+template <typename Kind>
+void EntityStore<Kind>::resizeArrays(int newCapacity) {
+    posX.resize(newCapacity);
+    posY.resize(newCapacity);
+    velX.resize(newCapacity);
+    velY.resize(newCapacity);
+    radius.resize(newCapacity);
+    age.resize(newCapacity);
+
+    if constexpr (Kind::hasAngle) angle.resize(newCapacity);
+    if constexpr (Kind::hasShape) shape.resize(newCapacity);
+
+    slotOf.resize(newCapacity);
+    indexOf.resize(newCapacity);
+    generation.resize(newCapacity);
+
+    scratchDouble.resize(newCapacity);
+    scratchInt.resize(newCapacity);
+    if constexpr (Kind::hasShape) scratchByte.resize(newCapacity);
+}
+
+/**
+ * New slots join the free end of the slot map in order, generation 0
+ */
+template <typename Kind>
+void EntityStore<Kind>::reserve(int newCapacity) {
+    newCapacity = std::min(newCapacity, ENTITY_MAX_SLOTS);
+    if (newCapacity <= cap)
+        return;
+
+    int oldCap = cap;
+    cap = newCapacity;
+    resizeArrays(cap);
+
+    for (int k = oldCap; k < cap; k++) {
+        slotOf[k] = k;
+        indexOf[k] = k;
+        generation[k] = 0;
+    }
+}
+
+/**
+ * Append to the packed range, doubling first if full and growable
+ */
+template <typename Kind>
+int EntityStore<Kind>::add(Point location, Point velocity, double r, double a) {
+    if (full()) {
+        if (!growable)
+            return -1;
+
+        reserve(cap > 0 ? cap * 2 : 16);
+        if (full())
+            return -1;
+    }
+
+    // slotOf[i] is already the next free slot
+    int i = count++;
+
+    wrapLocation(location);
+
+    posX[i] = location.x;
+    posY[i] = location.y;
+    velX[i] = velocity.x;
+    velY[i] = velocity.y;
+    radius[i] = r;
+    age[i] = 0;
+
+    if constexpr (Kind::hasAngle) angle[i] = a;
+    if constexpr (Kind::hasShape) shape[i] = 0;
+
+    return i;
+}
+
+/**
+ * Swap-remove: last entity fills the hole, and the freed slot lands at the front of the free end
+ */
+template <typename Kind>
+void EntityStore<Kind>::remove(int i) {
+    int last = --count;
+    int freed = slotOf[i];
+
+    generation[freed] = static_cast<std::uint16_t>((generation[freed] + 1) & (ENTITY_GENERATIONS - 1));
+
+    slotOf[i] = slotOf[last];
+    slotOf[last] = freed;
+    indexOf[slotOf[i]] = i;
+    indexOf[freed] = last;
+
+    if (i == last)
+        return;
+
+    posX[i] = posX[last];
+    posY[i] = posY[last];
+    velX[i] = velX[last];
+    velY[i] = velY[last];
+    radius[i] = radius[last];
+    age[i] = age[last];
+
+    if constexpr (Kind::hasAngle) angle[i] = angle[last];
+    if constexpr (Kind::hasShape) shape[i] = shape[last];
+}
+
+/**
+ * Slots stay where they are in the map, only their generations move on
+ */
+template <typename Kind>
+void EntityStore<Kind>::clear() {
+    for (int i = 0; i < count; i++) {
+        int slot = slotOf[i];
+        generation[slot] = static_cast<std::uint16_t>((generation[slot] + 1) & (ENTITY_GENERATIONS - 1));
+    }
+
+    count = 0;
+}
+
+/**
+ * Gathers field[order[k]] into scratch and swaps the buffers, no allocation
+ */
+template <typename T>
+static void permute(std::vector<T>& field, std::vector<T>& scratch, const int* order, int n) {
+    for (int k = 0; k < n; k++) {
+        scratch[k] = field[order[k]];
+    }
+    field.swap(scratch);
+}
+
+template <typename Kind>
+void EntityStore<Kind>::reorder(const int* order) {
+    permute(posX, scratchDouble, order, count);
+    permute(posY, scratchDouble, order, count);
+    permute(velX, scratchDouble, order, count);
+    permute(velY, scratchDouble, order, count);
+    permute(radius, scratchDouble, order, count);
+    permute(age, scratchInt, order, count);
+
+    if constexpr (Kind::hasAngle) permute(angle, scratchDouble, order, count);
+    if constexpr (Kind::hasShape) permute(shape, scratchByte, order, count);
+
+    // Copied back rather than swapped, the free end of the slot map has to stay put
+    for (int k = 0; k < count; k++) {
+        scratchInt[k] = slotOf[order[k]];
+    }
+    for (int k = 0; k < count; k++) {
+        slotOf[k] = scratchInt[k];
+        indexOf[slotOf[k]] = k;
+    }
+}
+
+/**
+ * Move + wrap (vectorized when the CPU allows), then age
+ */
+template <typename Kind>
+void EntityStore<Kind>::updatePositions() {
+    advanceBatch<Kind>(posX.data(), posY.data(), velX.data(), velY.data(), age.data(), count);
+}
+
+// ============================================================
+// Save / restore
+// ============================================================
+
+/**
+ * Position, velocity and radius always, the angle only for kinds that have one
+ */
+template <typename Kind>
+static constexpr int savedDoubles() {
+    return Kind::hasAngle ? 6 : 5;
+}
+
+/**
+ * Entities first, then the slot map (slots, then generations), each part padded to 8 bytes
+ */
+template <typename Kind>
+static std::size_t getEntityBytes(std::size_t n) {
+    std::size_t tail = n * sizeof(int) + (Kind::hasShape ? n : 0);
+    return n * savedDoubles<Kind>() * sizeof(double) + ((tail + 7) & ~static_cast<std::size_t>(7));
+}
+
+static std::size_t getSlotMapBytes(std::size_t capacity) {
+    return (capacity * (sizeof(int) + sizeof(std::uint16_t)) + 7) & ~static_cast<std::size_t>(7);
+}
+
+template <typename Kind>
+std::size_t EntityStore<Kind>::getSaveBytes(int n, int capacity) {
+    return getEntityBytes<Kind>(static_cast<std::size_t>(n)) + getSlotMapBytes(static_cast<std::size_t>(capacity));
+}
+
+template <typename Kind>
+bool EntityStore<Kind>::isSaveValid(const unsigned char* in, int n, int capacity) {
+    if (n < 0 || capacity <= 0 || n > capacity || capacity > ENTITY_MAX_SLOTS)
+        return false;
+
+    // The block is 8 byte aligned and so is the map, the slots and generations can be read in place
+    const unsigned char* map = in + getEntityBytes<Kind>(static_cast<std::size_t>(n));
+    const int* slots = reinterpret_cast<const int*>(map);
+    const std::uint16_t* generations = reinterpret_cast<const std::uint16_t*>(map + capacity * sizeof(int));
+    std::vector<char> seen(capacity, 0);
+
+    for (int k = 0; k < capacity; k++) {
+        int slot = slots[k];
+        if (slot < 0 || slot >= capacity || seen[slot] || generations[k] >= ENTITY_GENERATIONS)
+            return false;
+        seen[slot] = 1;
+    }
+
+    // Positions and velocities go straight into the wrap and the grid, radii into the split and the scoring
+    std::size_t count = static_cast<std::size_t>(n);
+    const double* saved = reinterpret_cast<const double*>(in);
+    const double* x = saved;
+    const double* y = saved + count;
+    const double* vx = saved + count * 2;
+    const double* vy = saved + count * 3;
+    const double* r = saved + count * 4;
+
+    for (std::size_t i = 0; i < count; i++) {
+        if (!isOnScreen({x[i], y[i]}) || !isWrappable({vx[i], vy[i]}) || !isKnownRadius<Kind>(r[i]))
+            return false;
+
+        if constexpr (Kind::hasAngle) {
+            if (!std::isfinite(saved[count * 5 + i]))
+                return false;
+        }
+    }
+
+    // Shapes index the ShapeLibrary's tables
+    if constexpr (Kind::hasShape) {
+        const unsigned char* shapes = in + count * savedDoubles<Kind>() * sizeof(double) + count * sizeof(int);
+
+        for (std::size_t i = 0; i < count; i++) {
+            if (shapes[i] >= ASTEROID_SHAPES)
+                return false;
+        }
+    }
+    return true;
+}
+
+template <typename Kind>
+void EntityStore<Kind>::getSavedHandles(const unsigned char* in, int n, int capacity,
+                                        std::vector<EntityHandle>& handles) {
+    const unsigned char* map = in + getEntityBytes<Kind>(static_cast<std::size_t>(n));
+    const int* slots = reinterpret_cast<const int*>(map);
+    const std::uint16_t* generations = reinterpret_cast<const std::uint16_t*>(map + capacity * sizeof(int));
+
+    handles.assign(capacity, NO_ENTITY);
+
+    // Live entities' slots come first in the map
+    for (int k = 0; k < n; k++) {
+        int slot = slots[k];
+        handles[slot] = (static_cast<EntityHandle>(generations[slot]) << ENTITY_SLOT_BITS) |
+                        static_cast<EntityHandle>(slot);
+    }
+}
+
+/**
+ * One memcpy per field, the block mirrors the arrays
+ */
+template <typename Kind>
+void EntityStore<Kind>::saveTo(unsigned char* out) const {
+    std::size_t n = static_cast<std::size_t>(count);
+    unsigned char* map = out + getEntityBytes<Kind>(n);
+    const std::vector<double>* doubles[6] = {&posX, &posY, &velX, &velY, &radius, &angle};
+
+    for (int f = 0; f < savedDoubles<Kind>(); f++) {
+        std::memcpy(out, doubles[f] -> data(), n * sizeof(double));
+        out += n * sizeof(double);
+    }
+
+    std::memcpy(out, age.data(), n * sizeof(int));
+    out += n * sizeof(int);
+
+    if constexpr (Kind::hasShape) {
+        std::memcpy(out, shape.data(), n);
+    }
+
+    std::size_t slots = static_cast<std::size_t>(cap);
+    std::memcpy(map, slotOf.data(), slots * sizeof(int));
+    std::memcpy(map + slots * sizeof(int), generation.data(), slots * sizeof(std::uint16_t));
+}
+
+template <typename Kind>
+void EntityStore<Kind>::loadFrom(const unsigned char* in, int n, int newCapacity) {
+    // Exactly newCapacity, even if that is smaller than now: a photon store's capacity is its torpedo budget.
+    // The slot map comes from the block, so it isn't initialised here.
+    cap = newCapacity;
+    count = n;
+    resizeArrays(cap);
+
+    std::size_t bytes = static_cast<std::size_t>(n);
+    const unsigned char* map = in + getEntityBytes<Kind>(bytes);
+    std::vector<double>* doubles[6] = {&posX, &posY, &velX, &velY, &radius, &angle};
+
+    for (int f = 0; f < savedDoubles<Kind>(); f++) {
+        std::memcpy(doubles[f] -> data(), in, bytes * sizeof(double));
+        in += bytes * sizeof(double);
+    }
+
+    std::memcpy(age.data(), in, bytes * sizeof(int));
+    in += bytes * sizeof(int);
+
+    if constexpr (Kind::hasShape) {
+        std::memcpy(shape.data(), in, bytes);
+    }
+
+    std::size_t slots = static_cast<std::size_t>(cap);
+    std::memcpy(slotOf.data(), map, slots * sizeof(int));
+    std::memcpy(generation.data(), map + slots * sizeof(int), slots * sizeof(std::uint16_t));
+
+    for (int k = 0; k < cap; k++) {
+        indexOf[slotOf[k]] = k;
+    }
+}
+
+template class EntityStore<AsteroidKind>;
+template class EntityStore<PhotonKind>;
@@ -0,0 +1,292 @@
+/*
+*   File: entityStore.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Structure-of-arrays storage for asteroids and photons. Every field lives in its own contiguous array,
+*   live entities are always packed into [0, size()), and removing one moves the last entity into its slot. The store
+*   is a template on its kind (kernels.h), so each one holds a single type with no per-entity tag, and only keeps the
+*   fields that kind has: asteroids carry an outline but no angle, photons an angle but no outline.
+*   Indices move (swap-remove, reorder), so anything that has to find an entity again later holds a generational
+*   handle instead: a slot that stays with the entity for its whole life, plus the slot's generation, which is bumped
+*   when the entity goes so old handles stop resolving.
+*
+*/
+
+#ifndef ENTITYSTORE_H
+#define ENTITYSTORE_H
+#include "constants.h"
+#include "spaceObject.h"
+#include "kernels.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ===================== Handles ============================================================
+
+// Slot in the low ENTITY_SLOT_BITS, the slot's generation (mod ENTITY_GENERATIONS) above it
+typedef std::uint32_t EntityHandle;
+
+const int ENTITY_SLOT_BITS = 20;
+const int ENTITY_MAX_SLOTS = (1 << ENTITY_SLOT_BITS) - 1;       // the all-ones slot is never used
+const std::uint32_t ENTITY_SLOT_MASK = (1u << ENTITY_SLOT_BITS) - 1;
+const std::uint32_t ENTITY_GENERATIONS = 1u << (32 - ENTITY_SLOT_BITS);
+
+// Never resolves, in any store
+const EntityHandle NO_ENTITY = 0xFFFFFFFF;
+
+// ===================== Store ==============================================================
+
+template <typename Kind>
+class EntityStore {
+    private:
+
+    int count;
+    int cap;
+
+    // Growable stores double instead of refusing add() when full
+    bool growable;
+
+    std::vector<double> posX;
+    std::vector<double> posY;
+    std::vector<double> velX;
+    std::vector<double> velY;
+    std::vector<double> radius;
+    std::vector<int> age;
+
+    // Only sized for kinds that have them, left empty otherwise
+    std::vector<double> angle;
+    std::vector<unsigned char> shape;     // index into the ShapeLibrary, scaled by radius when drawn
+
+    // Slot map. slotOf is a permutation of every slot: [0, count) are the live entities' slots in index order,
+    // [count, cap) the free ones, next to be reused first. indexOf is its inverse.
+    std::vector<int> slotOf;
+    std::vector<int> indexOf;
+    std::vector<std::uint16_t> generation;
+
+    // reorder() permutes into these and swaps them in
+    std::vector<double> scratchDouble;
+    std::vector<int> scratchInt;
+    std::vector<unsigned char> scratchByte;
+
+    void resizeArrays(int newCapacity);
+
+    public:
+
+    /**
+     * Allocates every array once, up front.
+     *
+     * @param capacity Most entities the store can hold before it grows (or refuses add() if not growable)
+     * @param growable Double the capacity when an add() finds the store full
+    */
+    explicit EntityStore(int capacity, bool growable = false);
+
+    // ===================== Mutators(Setters) ===========================================
+
+    /**
+     * Appends an entity to the end of the packed range.
+     *
+     * @param location Initial position (wrapped onto the screen)
+     * @param velocity Initial velocity
+     * @param r Collision radius
+     * @param a Orientation angle (degrees), ignored by kinds without one
+     * @return Index of the new entity, or -1 if the store is full and not growable (or out of handle slots)
+    */
+    int add(Point location, Point velocity, double r, double a = 0.0);
+
+    /**
+     * Makes room for at least newCapacity entities without moving the packed range. Never shrinks.
+     *
+     * @param newCapacity Capacity wanted (at most ENTITY_MAX_SLOTS)
+    */
+    void reserve(int newCapacity);
+
+    /**
+     * Removes an entity by moving the last one into its place (swap-remove), and retires its handle.
+     * Indices above i are untouched, the entity that was last is now at i (its handle still finds it).
+     *
+     * @param i Index in [0, size())
+    */
+    void remove(int i);
+
+    /**
+     * Removes every entity. Their handles are retired too.
+    */
+    void clear();
+
+    /**
+     * Moves the live entities into a new order without changing what they are: entity order[k] ends up at index k.
+     * Handles keep finding the same entities.
+     *
+     * @param order Permutation of [0, size())
+    */
+    void reorder(const int* order);
+
+    /**
+     * Adds each velocity to its position, wraps around the screen and ages every entity by one tick.
+    */
+    void updatePositions();
+
+    /**
+     * Pushes an entity along its angle, capped at MAX_SPEED (same rule as SpaceObject::applyThrust).
+     * Only compiles for kinds that thrust.
+     *
+     * @param i Index in [0, size())
+     * @param thrustAmount Speed added along the facing direction
+    */
+    template <typename K = Kind>
+    void applyThrust(int i, double thrustAmount) {
+        thrust<K>(angle[i], thrustAmount, velX[i], velY[i]);
+    }
+
+    /**
+     * Picks which ShapeLibrary outline an entity is drawn with. Only compiles for kinds with a shape.
+     *
+     * @param i Index in [0, size())
+     * @param s Shape index in [0, ASTEROID_SHAPES)
+    */
+    template <typename K = Kind>
+    void setShape(int i, int s) {
+        static_assert(K::hasShape, "this kind has no shape");
+        shape[i] = static_cast<unsigned char>(s);
+    }
+
+    /**
+     * Replaces an entity's velocity (a bounce). Not capped, MAX_SPEED is only for thrust.
+     *
+     * @param i Index in [0, size())
+     * @param velocity New velocity
+    */
+    void setVelocity(int i, Point velocity) {
+        velX[i] = velocity.x;
+        velY[i] = velocity.y;
+    }
+
+    // ===================== Save / restore ====================================================
+
+    /**
+     * @param n Number of entities
+     * @param capacity Capacity of the store
+     * @return Bytes saveTo() writes for n entities of this kind (a multiple of 8)
+    */
+    static std::size_t getSaveBytes(int n, int capacity);
+
+    /**
+     * Checks that a saveTo() block's slot map is whole (every slot exactly once, no generation out of range),
+     * so loadFrom() can't leave a handle that finds the wrong entity or none, and that every entity is one the
+     * World could have made: on the screen, moving less than a screen a tick, a size its kind comes in, a finite
+     * angle and (for kinds with one) a shape in the ShapeLibrary.
+     *
+     * @param in Block written by saveTo(), 8 byte aligned
+     * @param n Entities in the block
+     * @param capacity Capacity it was saved with
+     * @return True if loadFrom() may be given it
+    */
+    static bool isSaveValid(const unsigned char* in, int n, int capacity);
+
+    /**
+     * Handles of the entities in a saveTo() block, by slot, so what a save refers to by handle can be checked
+     * before it is loaded.
+     *
+     * @param in Block passed by isSaveValid()
+     * @param n Entities in the block
+     * @param capacity Capacity it was saved with
+     * @param handles Replaced with capacity handles: the entity's in each live slot, NO_ENTITY in free ones
+    */
+    static void getSavedHandles(const unsigned char* in, int n, int capacity, std::vector<EntityHandle>& handles);
+
+    /**
+     * Copies the live entities out one field at a time: position, velocity and radius, the angles if the kind has
+     * them, the ages, the shapes if it has those, then the whole slot map (so saved handles still resolve).
+     *
+     * @param out At least getSaveBytes(size(), capacity()) bytes, 8 byte aligned
+    */
+    void saveTo(unsigned char* out) const;
+
+    /**
+     * Replaces the contents with n entities from a saveTo() block, and sets the capacity to exactly newCapacity
+     * (for a store that isn't growable, that is its limit).
+     *
+     * @param in Block written by saveTo() and passed by isSaveValid(), 8 byte aligned
+     * @param n Entities in the block
+     * @param newCapacity Capacity it was saved with
+    */
+    void loadFrom(const unsigned char* in, int n, int newCapacity);
+
+    // ===================== Accessors(Getters) ===========================================
+
+    int size() const { return count; }
+    int capacity() const { return cap; }
+    bool full() const { return count >= cap; }
+
+    // Every entity in the store is the same type
+    SpaceObjType getType(int) const { return Kind::type; }
+    Point getLocation(int i) const { return {posX[i], posY[i]}; }
+    Point getVelocity(int i) const { return {velX[i], velY[i]}; }
+    double getRadius(int i) const { return radius[i]; }
+    int getAge(int i) const { return age[i]; }
+
+    // ===================== Handles ====================================================
+
+    /**
+     * @param i Index in [0, size())
+     * @return Handle that finds this entity for as long as it lives, wherever it moves
+    */
+    EntityHandle getHandle(int i) const {
+        int slot = slotOf[i];
+        return (static_cast<EntityHandle>(generation[slot]) << ENTITY_SLOT_BITS) | static_cast<EntityHandle>(slot);
+    }
+
+    /**
+     * Looks a handle up in O(1).
+     *
+     * @param h Handle from getHandle(), or NO_ENTITY
+     * @return Current index of the entity, or -1 if it has been removed since (or h is NO_ENTITY)
+    */
+    int find(EntityHandle h) const {
+        int slot = static_cast<int>(h & ENTITY_SLOT_MASK);
+        if (slot >= cap || generation[slot] != (h >> ENTITY_SLOT_BITS))
+            return -1;
+
+        int i = indexOf[slot];
+        return i < count ? i : -1;
+    }
+
+    bool isAlive(EntityHandle h) const { return find(h) >= 0; }
+
+    /**
+     * @param i Index in [0, size())
+     * @return The entity's slot, in [0, capacity()) and fixed for its life (for side tables indexed by slot)
+    */
+    int getSlot(int i) const { return slotOf[i]; }
+
+    // 0 for kinds without the field
+    double getAngle(int i) const {
+        if constexpr (Kind::hasAngle) return angle[i];
+        else return 0.0;
+    }
+    int getShape(int i) const {
+        if constexpr (Kind::hasShape) return shape[i];
+        else return 0;
+    }
+
+    /**
+     * Packed arrays for linear sweeps, valid for indices [0, size()).
+    */
+    const double* getX() const { return posX.data(); }
+    const double* getY() const { return posY.data(); }
+    const double* getRadii() const { return radius.data(); }
+
+    template <typename K = Kind>
+    const unsigned char* getShapes() const {
+        static_assert(K::hasShape, "this kind has no shape");
+        return shape.data();
+    }
+
+};
+
+typedef EntityStore<AsteroidKind> AsteroidStore;
+typedef EntityStore<PhotonKind> PhotonStore;
+
+#endif
@@ -12,67 +12,125 @@
 #include <SFML/Graphics.hpp>
 #include "spaceObject.h"
 #include "constants.h"
+#include "world.h"
+#include "renderer.h"
+#include "hud.h"
+#include "particles.h"
+#include "profiler.h"
+#include "replay.h"
+#include "simThread.h"
+#include "timing.h"
+#include "threadPool.h"
+#include "saveState.h"
 #include <optional>
+#include <algorithm>
 #include <cmath>
+#include <chrono>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
 
 // ============================================================
-// Part 1 Required Helper Functions (game.cpp)
+// Profiler Overlay (F3)
 // ============================================================
 
 /**
- * Gets a random location within the screen bounds.
+ * Draws frame time min/avg/p99, the sim thread's tick time, frame pacing jitter and the average cost of each phase in
+ * the top-right corner.
+ * Sim phases come from the snapshot, so this never reads the sim thread's Profiler.
  *
- * @return Point with x in [0, SCREEN_WIDTH) and y in [0, SCREEN_HEIGHT)
+ * @param window SFML render window to draw to
+ * @param font Font for the overlay text
+ * @param profiler Render thread profiler
+ * @param pacer Frame pacer, for the interval jitter
+ * @param snapshot Latest snapshot, carries the sim thread's timings
+ * @param hudLayouts How often the HUD has been laid out (should only move when the score changes)
+ * @param particles Particles drawn this frame
  */
-Point getRandomLocation() {
-    Point p;
-    p.x = std::rand() % SCREEN_WIDTH;
-    p.y = std::rand() % SCREEN_HEIGHT;
-    return p;
-}
+void drawProfilerOverlay(sf::RenderWindow& window, const sf::Font& font, const Profiler& profiler,
+                         const FramePacer& pacer, const Snapshot& snapshot, long hudLayouts, int particles) {
+    FrameStats stats = profiler.getFrameStats();
+    JitterStats jitter = pacer.getJitterStats();
+
+    char buffer[640];
+    int length = std::snprintf(buffer, sizeof(buffer), "frame min %.2f avg %.2f p99 %.2f ms\n"
+                               "tick  min %.2f avg %.2f p99 %.2f ms\n"
+                               "pace  %.2f ms sd %.3f p99 %.3f ms\n"
+                               "hud   %ld layouts\n"
+                               "fx    %d particles\n",
+                               stats.minMs, stats.avgMs, stats.p99Ms, snapshot.simTickStats.minMs,
+                               snapshot.simTickStats.avgMs, snapshot.simTickStats.p99Ms,
+                               jitter.meanMs, jitter.stdDevMs, jitter.p99DeviationMs, hudLayouts, particles);
+
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        ProfilePhase phase = static_cast<ProfilePhase>(p);
+        bool simPhase = phase == PHASE_CONTROLS || phase == PHASE_UPDATE || phase == PHASE_COLLISIONS;
+        double ms = simPhase ? snapshot.simPhaseMs[p] : profiler.getPhaseAverageMs(phase);
+
+        length += std::snprintf(buffer + length, sizeof(buffer) - length, "%-10s %.3f ms\n",
+                                Profiler::getPhaseName(phase), ms);
+    }
 
-/**
- * Gets a random velocity with x and y in [-1, 1].
- *
- * @return Point with velocity components in [-1.0, 1.0]
- */
-Point getRandomVelocity() {
-    int rx = std::rand() % 201;
-    int ry = std::rand() % 201;
-
-    Point v;
-    v.x = (rx - 100) / 100.0;
-    v.y = (ry - 100) / 100.0;
-    return v;
+    sf::Text overlay(font);
+    overlay.setString(buffer);
+    overlay.setCharacterSize(8);
+    overlay.setFillColor(sf::Color::Green);
+    overlay.setPosition(sf::Vector2f(SCREEN_WIDTH - 300.f, 10.f));
+    window.draw(overlay);
 }
 
-// ============================================================
-// Part 2 Required Collision Function (NOT a class member)
-// ============================================================
-
-/**
- * Determines whether two SpaceObjects intersect on screen.
- *
- * @param a Pointer to first SpaceObject
- * @param b Pointer to second SpaceObject
- * @return true if distance between centers <= sum of radii
- */
-bool objectsIntersect(const SpaceObject* a, const SpaceObject* b) {
-    Point pa = a -> getLocation();
-    Point pb = b -> getLocation();
-
-    double dx = pa.x - pb.x;
-    double dy = pa.y - pb.y;
-
-    double distSq = dx * dx + dy * dy;
-    double radSum = a -> getRadius() + b -> getRadius();
-
-    return distSq <= (radSum * radSum);
-}
+int main(int argc, char* argv[]) {
+    // --trace FILE saves a Chrome trace of the last frames on exit, F4 saves one at any time
+    std::string tracePath = "trace.json";
+    bool traceOnExit = false;
+
+    // --record FILE saves every tick's input (and a state hash) so the session can be replayed with the sim
+    const char* recordPath = nullptr;
+    unsigned seed = 42;
+
+    // --fps N paces rendering to N frames per second (0 = unlimited), --vsync leaves pacing to the display instead.
+    // Gameplay runs at TICK_RATE either way.
+    double fps = 60;
+    bool vsync = false;
+
+    // --stress N starts with N asteroids, fires a 16-way fan and can't die (hold Space for rapid fire)
+    int stressAsteroids = 0;
+
+    // --ccd switches to swept collision tests, so nothing tunnels through small asteroids
+    bool continuous = false;
+
+    // --bounce makes asteroids bounce off each other instead of passing through
+    bool bounce = false;
+
+    // --load FILE starts from a save instead of a new game. F5 quick saves to quicksave.sav, F9 loads it back.
+    const char* loadPath = nullptr;
+    const std::string quickSavePath = "quicksave.sav";
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            tracePath = argv[++i];
+            traceOnExit = true;
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = static_cast<unsigned>(std::atol(argv[++i]));
+        } else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            fps = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--vsync") == 0) {
+            vsync = true;
+        } else if (std::strcmp(argv[i], "--stress") == 0 && i + 1 < argc) {
+            stressAsteroids = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--ccd") == 0) {
+            continuous = true;
+        } else if (std::strcmp(argv[i], "--bounce") == 0) {
+            bounce = true;
+        } else if (std::strcmp(argv[i], "--load") == 0 && i + 1 < argc) {
+            loadPath = argv[++i];
+        }
+    }
 
-int main() {
     // ============================================================
     // Window generation
     // ============================================================
@@ -82,14 +140,9 @@ int main() {
         "Asteroids - CS162"
     );
      
-    window.setFramerateLimit(60);
-    
-    // Initial score, lives, game start/end status and invincibility status
-    int score = 0;
-    int lives = 3;
-    bool gameOver = false;
-    bool invincible = false;
-    int invincibleTimer = 0;
+    // Sleep + spin pacer instead of setFramerateLimit, which only sleeps and overshoots by the OS timer resolution
+    window.setVerticalSyncEnabled(vsync);
+    FramePacer pacer(vsync ? 0.0 : fps);
     
     // Death Message
     sf::Font font;
@@ -97,352 +150,208 @@ int main() {
         std::cout << "Font Failed to load!\n";
     }
 
-    // ============================================================
-    // Part 1: Seed RNG exactly as specified
-    // ============================================================
-    std::srand(42);
+    // Pixel font: no filtering, so the HUD's scaled-up glyphs stay sharp
+    font.setSmooth(false);
 
     // ============================================================
-    // Part 0: Ship is a pointer + dynamically allocated
+    // Simulation: seeds the RNG (42 by default), ship + 5 asteroids
     // ============================================================
-    SpaceObject* ship = new SpaceObject();
+    WorldConfig config = stressAsteroids > 0 ? makeStressConfig(stressAsteroids) : WorldConfig();
+    config.continuousCollision = continuous;
+    config.asteroidBounce = bounce;
+    World world(seed, config);
+
+    // The save brings its own config; a recording made from here replays with the sim's --load
+    MappedFile startSave;
+    if (loadPath != nullptr && (!startSave.open(loadPath) || !world.load(startSave.data(), startSave.size()))) {
+        std::cout << "Could not load " << loadPath << ", starting a new game\n";
+    }
+    startSave.close();
 
+    // Stress mode spreads the photon collision pass over every core (0 = hardware threads), normal games stay serial
+    ThreadPool collisionPool(stressAsteroids > 0 ? 0 : 1);
+    world.setThreadPool(&collisionPool);
 
-    ship -> setLocation(SCREEN_WIDTH / 2.0, SCREEN_HEIGHT / 2.0);
-    ship -> setVelocity(0.0, 0.0);
-    ship -> setRadius(20.0);
-    ship -> setAngle(0.0);
+    ReplayRecorder recorder(seed, world.getConfig(), recordPath != nullptr ? REPLAY_RESERVE_TICKS : 0);
 
-    // ============================================================
-    // Part 1: Array of asteroid pointers sized MAX_ASTEROIDS
-    // - Initialize all entries to nullptr
-    // ============================================================
-    SpaceObject* asteroids[MAX_ASTEROIDS] = { nullptr };
+    // The World runs on its own thread at TICK_RATE, this thread only handles input and drawing
+    SimThread sim(world, recordPath != nullptr ? &recorder : nullptr, "sim-" + tracePath, quickSavePath);
 
-    SpaceObject* photons[MAX_PHOTONS] = {nullptr};
+    // Every object goes into one vertex batch, drawn with a single call
+    BatchRenderer renderer;
 
-    // Creates 5 asteroids in the first 5 slots
+    // Debris from breaks and explosions, a second batch of points on top
+    ParticleSystem particles;
+    std::chrono::steady_clock::time_point lastFrame = std::chrono::steady_clock::now();
 
-    for (int i = 0; i < 5; i++) {
-        asteroids[i] = new SpaceObject();
+    // Score, death message and restart prompt: laid out once, again only when they change, drawn in one call
+    Hud hud(font);
+    int scoreLabel = hud.addLabel({10.f, 10.f}, 1, false, sf::Color::White);
+    int gameOverLabel = hud.addLabel({SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f}, 3, true, sf::Color::Red);
+    int restartLabel = hud.addLabel({SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f + 40.f}, 1, true,
+                                    sf::Color(255, 140, 0));
+    hud.setText(gameOverLabel, "Game Over!");
+    hud.setText(restartLabel, "Press Y to Restart\nPress N to Quit");
+    int shownScore = -1;
 
-        Point p = getRandomLocation();
-        Point v = getRandomVelocity();
+    Profiler profiler;
+    bool showProfiler = false;
 
-        asteroids[i] -> setLocation(p.x, p.y);
-        asteroids[i] -> setVelocity(v.x, v.y);
-        asteroids[i] -> setRadius(25.0);
-        asteroids[i] -> setType(ASTEROID);
-        asteroids[i] -> generateAsteroidShape();
-    }
+    const double tickSeconds = 1.0 / TICK_RATE;
+    sim.start();
 
     // ============================================================
     // Game Loop
     // ============================================================
     while (window.isOpen()) {
 
+        profiler.beginFrame();
+
+        // Newest tick from the sim thread, stays put until the next frame
+        const Snapshot& snapshot = sim.latestSnapshot();
+
         // ---------------------
         // 1) Handle events
         // ---------------------
-        while (const std::optional<sf::Event> event = window.pollEvent()) {
-            if (event -> is<sf::Event::Closed>()) {
-                window.close();
-            }
-            if (event -> is <sf::Event::KeyPressed>()) {
-                if (event -> getIf<sf::Event::KeyPressed>() -> code == sf::Keyboard::Key::Space && ship -> getType() == SHIP) {
-                    for (int i = 0; i < MAX_PHOTONS; i++) {
-                        if (photons[i] == nullptr) {
-
-                            photons[i] = new SpaceObject();
-
-                            photons[i] -> setType(PHOTON_TORPEDO);
-                            photons[i] -> setRadius(2.0);
-
-                            photons[i] -> setLocation(   
-                                ship   -> getLocation().x,
-                                ship   -> getLocation().y
-                            );
-
-                            photons[i] -> setVelocity(
-                                ship   -> getVelocity().x, 
-                                ship   -> getVelocity().y
-                            );
-
-                            photons[i] -> setAngle(ship -> getAngle());
-
-                            photons[i] -> applyThrust(5.0);
+        {
+            ScopedTimer eventsTimer(&profiler, PHASE_EVENTS);
 
-                            break;
-                        }
-                    }
+            while (const std::optional<sf::Event> event = window.pollEvent()) {
+                if (event -> is<sf::Event::Closed>()) {
+                    window.close();
                 }
-            }
-
-            // ===================================================================
-            // Restart controls after user gets a game over
-            // ===================================================================
-
-            if (gameOver && event->is<sf::Event::KeyPressed>()) {
-                auto key = event->getIf<sf::Event::KeyPressed>()->code;
-
-                if (key == sf::Keyboard::Key::Y) {
+                if (event -> is <sf::Event::KeyPressed>()) {
+                    auto key = event -> getIf<sf::Event::KeyPressed>() -> code;
 
-                    // Reset game state
-                    score = 0;
-                    lives = 3;
-                    gameOver = false;
-
-                    // Delete all asteroids
-                    for (int i = 0; i < MAX_ASTEROIDS; i++) {
-                        delete asteroids[i];
-                        asteroids[i] = nullptr;
+                    if (key == sf::Keyboard::Key::Space) {
+                        sim.pressFire();
                     }
 
-                    // Recreate starting asteroids
-                    for (int i = 0; i < 5; i++) {
-                        asteroids[i] = new SpaceObject();
-                        Point p = getRandomLocation();
-                        Point v = getRandomVelocity();
-
-                        asteroids[i]->setType(ASTEROID);
-                        asteroids[i]->setLocation(p.x, p.y);
-                        asteroids[i]->setVelocity(v.x, v.y);
-                        asteroids[i]->setRadius(25.0);
+                    // ===================================================================
+                    // Restart controls after user gets a game over
+                    // ===================================================================
+                    if (snapshot.gameOver && key == sf::Keyboard::Key::Y) {
+                        sim.pressRestart();
+                    }
+                    if (snapshot.gameOver && key == sf::Keyboard::Key::N) {
+                        window.close();
                     }
 
-                    // Reset ship
-                    delete ship;
-                    ship = new SpaceObject();
-                    ship->setLocation(SCREEN_WIDTH / 2.0, SCREEN_HEIGHT / 2.0);
-                    ship->setRadius(20.0);
-                    ship->setAngle(0.0);
-
-                }
+                    // Profiler overlay / trace dump
+                    if (key == sf::Keyboard::Key::F3) {
+                        showProfiler = !showProfiler;
+                    }
+                    if (key == sf::Keyboard::Key::F4 && profiler.writeChromeTrace(tracePath)) {
+                        sim.requestTrace();
+                        std::cout << "Trace saved to " << tracePath << " and sim-" << tracePath << "\n";
+                    }
 
-                if (key == sf::Keyboard::Key::N) {
-                    window.close();
+                    // Quick save / quick load, done by the sim thread between ticks
+                    if (key == sf::Keyboard::Key::F5) {
+                        sim.requestSave();
+                    }
+                    if (key == sf::Keyboard::Key::F9) {
+                        sim.requestLoad();
+                    }
                 }
             }
 
+            // ---------------------
+            // 2) Controls (ship only), picked up by the sim thread on its next tick
+            // ---------------------
+            sim.setHeldKeys(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left),
+                            sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right),
+                            sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up));
+
+            // Stress mode: rapid fire while Space is held
+            if (stressAsteroids > 0 && sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space)) {
+                sim.pressFire();
+            }
         }
 
         // ---------------------
-        // 2) Controls (ship only)
+        // 3) + 4) Update positions and collisions run on the sim thread
         // ---------------------
-        if (!gameOver && sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left)) {
-            ship->changeAngle(-ROT_SPEED);
-        }
-        if (!gameOver && sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right)) {
-            ship->changeAngle(ROT_SPEED);
-        }
-        if (!gameOver && sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up)) {
-            ship->applyThrust(0.7);
-        }
 
         // ---------------------
-        // 3) Update positions
+        // 5) Draw everything
         // ---------------------
-
-        ship->updatePosition();
-
-        // =================================
-        // Respawn Logic
-        // =================================
-        if (ship -> getType() == SHIP_GONE && lives > 0) {
-
-            lives--;
-
-            delete ship;
-
-            ship = new SpaceObject;
-
-            ship -> setLocation(SCREEN_WIDTH / 2.0, SCREEN_HEIGHT / 2.0);
-            ship -> setVelocity(0.0, 0.0);
-            ship -> setRadius(20.0);
-            ship -> setAngle(0.0);
-
-            ship -> setInvincible(true);
-        }
-
-        for (int i = 0; i < MAX_ASTEROIDS; i++) {
-            if (asteroids[i] != nullptr) {
-                asteroids[i] -> updatePosition();
+        {
+            ScopedTimer drawTimer(&profiler, PHASE_DRAW);
+
+            window.clear(sf::Color::Black);
+
+            // How far into the next tick we are, objects are drawn that far between the last two ticks
+            double sincePublish = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                                snapshot.publishedAt).count();
+            renderer.build(snapshot, static_cast<float>(sincePublish / tickSeconds));
+            renderer.draw(window);
+
+            // Particles move on real frame time; a long stall is capped so nothing jumps across the screen
+            std::chrono::steady_clock::time_point frameTime = std::chrono::steady_clock::now();
+            double frameSeconds = std::chrono::duration<double>(frameTime - lastFrame).count();
+            lastFrame = frameTime;
+
+            particles.addEffects(snapshot);
+            particles.update(static_cast<float>(std::min(frameSeconds, 0.1)));
+            particles.build();
+            particles.draw(window);
+
+            // Score Display, only re-laid out when the score changes
+            if (snapshot.score != shownScore) {
+                shownScore = snapshot.score;
+
+                char scoreText[32];
+                std::snprintf(scoreText, sizeof(scoreText), "Score: %d", shownScore);
+                hud.setText(scoreLabel, scoreText);
             }
-        }
-        for (int i = 0; i < MAX_PHOTONS; i++) {
-            if (photons[i] != nullptr) {
 
-                photons[i] -> updatePosition();
+            // ====================================================================
+            // Death message displays after all lives lost
+            // ====================================================================
+            hud.setVisible(gameOverLabel, snapshot.gameOver);
+            hud.setVisible(restartLabel, snapshot.gameOver);
 
-                if (photons[i] -> getTimesDrawn() > PHOTON_LIFESPAN) {
-                    delete photons[i];
-                    photons[i] = nullptr;
-                }
-            }
-        }
+            if (snapshot.gameOver) {
+                // ============= Pulsing restart prompt (colour only, no layout) ====
+                static float pulse = 0.f;
+                pulse += 0.05f;
 
-        // -------------------------------------------------
-        // 4) Part 2 + Part 3: Collision -> explode()
-        // -------------------------------------------------
-        for (int i = 0; i < MAX_ASTEROIDS; i++) {
-            if (asteroids[i] != nullptr) {
-                if (!ship -> isInvincible() && objectsIntersect(ship, asteroids[i]) 
-                    && ship -> getType() == SHIP) {
-                    ship -> explode();
-                    
-                    if (lives <= 1) {
-                        gameOver = true;
-                    }
-
-                    break;
-                }
+                int alpha = 128 + std::sin(pulse) * 127;
+                hud.setColor(restartLabel, sf::Color(255, 140, 0, static_cast<std::uint8_t>(alpha)));
             }
-        }
-
-        // Photon vs Asteroid collision
-        for (int p = 0; p < MAX_PHOTONS; p++) {
-
-            if (photons[p] == nullptr)
-                continue;
-
-            for (int a = 0; a < MAX_ASTEROIDS; a++) {
-
-                if (asteroids[a] == nullptr)
-                    continue;
-
-                if (objectsIntersect(photons[p], asteroids[a])) {
-
-                    double oldRadius = asteroids[a]->getRadius();
-                    Point hitLocation = asteroids[a]->getLocation();
 
-                    // Delete photon
-                    delete photons[p];
-                    photons[p] = nullptr;
+            hud.draw(window);
 
-                    // If asteroid large enough → split
-                    if (oldRadius > 6.25) {
-
-                        int created = 0;
-
-                            for (int i = 0; i < MAX_ASTEROIDS && created < 2; i++) {
-
-                                if (asteroids[i] == nullptr) {
-
-                                    asteroids[i] = new SpaceObject();
-                                    asteroids[i] -> setType(ASTEROID);
-                                    asteroids[i] -> setRadius(oldRadius / 2.0);
-                                    asteroids[i] -> generateAsteroidShape();
-                                    asteroids[i] -> setLocation(hitLocation.x, hitLocation.y);
-
-                                    Point v = getRandomVelocity();
-                                    asteroids[i]->setVelocity(v.x * 2, v.y * 2);
-
-                                    created++;
-                                }
-                            }
-                    }
-
-                    // Calculate Score
-
-                    if (oldRadius == 25.0) {
-                        score += 10;
-                    } else if (oldRadius == 12.5) {
-                        score += 20;
-                    } else {
-                        score += 40;
-                    }
-
-                    // Delete original asteroid
-                    delete asteroids[a];
-                    asteroids[a] = nullptr;
-
-                    break;
-                }
+            if (showProfiler) {
+                drawProfilerOverlay(window, font, profiler, pacer, snapshot, hud.getLayoutCount(),
+                                    particles.getLiveCount());
             }
         }
 
+        {
+            ScopedTimer displayTimer(&profiler, PHASE_DISPLAY);
+            window.display();
+        }
 
-        // ---------------------
-        // 5) Draw everything
-        // ---------------------
-        window.clear(sf::Color::Black);
+        pacer.wait();
 
-        for (int i = 0; i < MAX_ASTEROIDS; i++) {
-            if (asteroids[i] != nullptr) {
-                asteroids[i] -> draw(window);
-            }
-        }
+        profiler.endFrame();
+    }
 
-        for (int i = 0; i < MAX_PHOTONS; i++) {
-            if (photons[i] != nullptr) {
-                photons[i] -> draw(window);
-            }
-        }
+    sim.stop();
 
-        ship -> draw(window);
-
-        // Score Display
-        sf::Text scoreText(font);
-        scoreText.setString("Score: " + std::to_string(score));
-        scoreText.setCharacterSize(18);
-        scoreText.setFillColor(sf::Color::White);
-        scoreText.setPosition(sf::Vector2f(10.f, 10.f));
-        window.draw(scoreText);
-
-        // ====================================================================
-        // Death message displays after all lives lost
-        // ====================================================================
-        if (gameOver) {
-            sf::Text gameOverText(font);
-            gameOverText.setString("Game Over!");
-            gameOverText.setCharacterSize(48);
-            gameOverText.setFillColor(sf::Color::Red);
-
-            // Get text bounds
-            sf::FloatRect textBounds = gameOverText.getLocalBounds();
-
-            // Set origin to center of death message
-            gameOverText.setOrigin(
-                textBounds.position + textBounds.size / 2.f
-            );
-
-            // Position in the middle of the window
-            gameOverText.setPosition(sf::Vector2f(
-                SCREEN_WIDTH / 2.0f,
-                SCREEN_HEIGHT / 2.0f
-            ));
-            window.draw(gameOverText);
-
-            // ============= Pulsing restart prompt =========================
-            static float pulse = 0.f;
-            pulse += 0.05f;
-
-            int alpha = 128 + std::sin(pulse) * 127;
-
-            sf::Text restartText(font);
-            restartText.setString("Press Y to Restart\nPress N to Quit");
-            restartText.setCharacterSize(18);
-            restartText.setFillColor(sf::Color(255, 140, 0, alpha));
-
-            sf::FloatRect rBounds = restartText.getLocalBounds();
-            restartText.setOrigin(rBounds.position + rBounds.size / 2.f);
-            restartText.setPosition({SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f + 40.f});
-
-            window.draw(restartText);
-        }
+    JitterStats jitter = pacer.getJitterStats();
+    std::cout << "Frame interval: " << jitter.meanMs << " ms avg, " << jitter.stdDevMs << " ms std dev, "
+              << jitter.p99DeviationMs << " ms p99 off target (last " << jitter.frames << " frames)\n";
 
-        window.display();
+    const Profiler* profilers[2] = {&profiler, &sim.getProfiler()};
+    if (traceOnExit && Profiler::writeChromeTrace(tracePath, profilers, 2)) {
+        std::cout << "Trace saved to " << tracePath << "\n";
     }
 
-    // ============================================================
-    // Cleanup
-    // ============================================================
-    delete ship;
-    ship = nullptr;
-
-    for (int i = 0; i < MAX_ASTEROIDS; i++) {
-        delete asteroids[i];
-        asteroids[i] = nullptr;
+    if (recordPath != nullptr && recorder.save(recordPath)) {
+        std::cout << "Recorded " << recorder.getTickCount() << " ticks to " << recordPath << "\n";
     }
 
     return 0;
@@ -0,0 +1,181 @@
+/*
+*   File: hud.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Cached HUD text, laid out into one vertex batch from a single glyph page.
+*/
+
+#include "hud.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+Hud::Hud(const sf::Font& font) : font(font), quads(sf::PrimitiveType::Triangles) {
+    dirty = true;
+    layoutCount = 0;
+}
+
+int Hud::addLabel(sf::Vector2f position, float scale, bool centered, sf::Color color) {
+    Label label;
+    label.text[0] = '\0';
+    label.position = position;
+    label.scale = scale;
+    label.centered = centered;
+    label.visible = true;
+    label.color = color;
+    label.firstVertex = 0;
+    label.vertexCount = 0;
+
+    labels.push_back(label);
+    dirty = true;
+    return static_cast<int>(labels.size()) - 1;
+}
+
+void Hud::setText(int label, const char* text) {
+    Label& l = labels[label];
+    if (std::strncmp(l.text, text, HUD_LABEL_CHARS - 1) == 0)
+        return;
+
+    std::strncpy(l.text, text, HUD_LABEL_CHARS - 1);
+    l.text[HUD_LABEL_CHARS - 1] = '\0';
+    dirty = true;
+}
+
+void Hud::setVisible(int label, bool visible) {
+    if (labels[label].visible == visible)
+        return;
+
+    labels[label].visible = visible;
+    dirty = true;
+}
+
+void Hud::setColor(int label, sf::Color color) {
+    Label& l = labels[label];
+    l.color = color;
+
+    // A pending layout will pick the colour up anyway
+    if (dirty)
+        return;
+
+    for (int v = l.firstVertex; v < l.firstVertex + l.vertexCount; v++) {
+        quads[v].color = color;
+    }
+}
+
+/**
+ * Same placement as sf::Text: the first baseline sits one character size down, kerning between pairs, advance per
+ * glyph, and a line spacing down on '\n'. Quads are built relative to the label first, then moved into place once
+ * the bounds are known (centred labels need them).
+ */
+void Hud::layoutLabel(Label& label) {
+    label.firstVertex = static_cast<int>(quads.getVertexCount());
+    label.vertexCount = 0;
+
+    if (!label.visible)
+        return;
+
+    float s = label.scale;
+    float x = 0;
+    float y = static_cast<float>(HUD_GLYPH_SIZE);
+    char32_t previous = 0;
+
+    float minX = 0, minY = 0, maxX = 0, maxY = 0;
+    bool any = false;
+
+    for (const char* c = label.text; *c != '\0'; c++) {
+        char32_t code = static_cast<unsigned char>(*c);
+
+        if (code == '\n') {
+            x = 0;
+            y += font.getLineSpacing(HUD_GLYPH_SIZE);
+            previous = 0;
+            continue;
+        }
+
+        x += font.getKerning(previous, code, HUD_GLYPH_SIZE);
+        previous = code;
+
+        const sf::Glyph& glyph = font.getGlyph(code, HUD_GLYPH_SIZE, false);
+
+        float left = x + glyph.bounds.position.x;
+        float top = y + glyph.bounds.position.y;
+        float right = left + glyph.bounds.size.x;
+        float bottom = top + glyph.bounds.size.y;
+
+        float u0 = static_cast<float>(glyph.textureRect.position.x);
+        float v0 = static_cast<float>(glyph.textureRect.position.y);
+        float u1 = u0 + glyph.textureRect.size.x;
+        float v1 = v0 + glyph.textureRect.size.y;
+
+        x += glyph.advance;
+
+        // Spaces have no quad, only an advance
+        if (glyph.textureRect.size.x == 0 || glyph.textureRect.size.y == 0)
+            continue;
+
+        sf::Vertex corners[4] = {
+            {{left * s, top * s}, label.color, {u0, v0}},
+            {{right * s, top * s}, label.color, {u1, v0}},
+            {{left * s, bottom * s}, label.color, {u0, v1}},
+            {{right * s, bottom * s}, label.color, {u1, v1}}
+        };
+
+        quads.append(corners[0]);
+        quads.append(corners[1]);
+        quads.append(corners[2]);
+        quads.append(corners[2]);
+        quads.append(corners[1]);
+        quads.append(corners[3]);
+        label.vertexCount += 6;
+
+        minX = any ? std::min(minX, left * s) : left * s;
+        minY = any ? std::min(minY, top * s) : top * s;
+        maxX = any ? std::max(maxX, right * s) : right * s;
+        maxY = any ? std::max(maxY, bottom * s) : bottom * s;
+        any = true;
+    }
+
+    // Whole pixels, so the pixel font stays sharp
+    sf::Vector2f offset = label.position;
+    if (label.centered) {
+        offset.x -= (minX + maxX) / 2.f;
+        offset.y -= (minY + maxY) / 2.f;
+    }
+    offset.x = std::round(offset.x);
+    offset.y = std::round(offset.y);
+
+    for (int v = label.firstVertex; v < label.firstVertex + label.vertexCount; v++) {
+        quads[v].position.x += offset.x;
+        quads[v].position.y += offset.y;
+    }
+}
+
+/**
+ * Rebuilds the whole batch; the vertex array keeps its capacity, so this only allocates when the HUD gets longer
+ */
+void Hud::layout() {
+    quads.clear();
+
+    for (Label& label : labels) {
+        layoutLabel(label);
+    }
+
+    dirty = false;
+    layoutCount++;
+}
+
+void Hud::draw(sf::RenderWindow& window) {
+    if (dirty) {
+        layout();
+    }
+
+    sf::RenderStates states;
+    states.texture = &font.getTexture(HUD_GLYPH_SIZE);
+    window.draw(quads, states);
+}
+
+long Hud::getLayoutCount() const {
+    return layoutCount;
+}
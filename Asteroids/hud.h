@@ -0,0 +1,105 @@
+/*
+*   File: hud.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Cached HUD text. Every label is laid out once into textured quads from the font's glyph page and kept;
+*   it is only laid out again when its text or visibility changes, and a colour change just rewrites its vertex
+*   colours. All labels share one glyph page (bigger text is the same glyphs scaled up), so the whole HUD is one draw.
+*
+*/
+
+#ifndef HUD_H
+#define HUD_H
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Every label is drawn from this one glyph size. PressStart2P is an 8px pixel font, so with smoothing off whole
+// multiples of this look the same as glyphs rendered at that size.
+const unsigned HUD_GLYPH_SIZE = 16;
+
+// Longest label text, including the terminator
+const int HUD_LABEL_CHARS = 64;
+
+class Hud {
+    private:
+
+    struct Label {
+        char text[HUD_LABEL_CHARS];
+        sf::Vector2f position;
+        float scale;
+        bool centered;
+        bool visible;
+        sf::Color color;
+        int firstVertex;      // where layout() put its quads
+        int vertexCount;
+    };
+
+    const sf::Font& font;
+    std::vector<Label> labels;
+    sf::VertexArray quads;
+
+    bool dirty;
+    long layoutCount;
+
+    void layout();
+    void layoutLabel(Label& label);
+
+    public:
+
+    /**
+     * @param font Loaded font (kept by reference, must outlive the Hud)
+    */
+    explicit Hud(const sf::Font& font);
+
+    /**
+     * Adds an empty label.
+     *
+     * @param position Top-left corner, or the center if centered
+     * @param scale Multiple of HUD_GLYPH_SIZE to draw at (whole numbers keep the pixel font sharp)
+     * @param centered Whether position is the center of the text's bounds
+     * @param color Fill colour
+     * @return Label id
+    */
+    int addLabel(sf::Vector2f position, float scale, bool centered, sf::Color color);
+
+    /**
+     * Changes a label's text; the HUD is only laid out again if it differs from what is already there.
+     * Text longer than HUD_LABEL_CHARS - 1 is cut off.
+     *
+     * @param label Id from addLabel
+     * @param text New text ('\n' starts a new line)
+    */
+    void setText(int label, const char* text);
+
+    /**
+     * Shows or hides a label (laid out again only when this changes).
+     *
+     * @param label Id from addLabel
+     * @param visible Whether to draw it
+    */
+    void setVisible(int label, bool visible);
+
+    /**
+     * Recolours a label in place, no layout.
+     *
+     * @param label Id from addLabel
+     * @param color New fill colour
+    */
+    void setColor(int label, sf::Color color);
+
+    /**
+     * Lays out anything that changed, then draws every visible label in one call.
+     *
+     * @param window SFML render window to draw to
+    */
+    void draw(sf::RenderWindow& window);
+
+    /**
+     * @return How many times the HUD has been laid out, to check it isn't happening every frame
+    */
+    long getLayoutCount() const;
+
+};
+#endif
@@ -0,0 +1,144 @@
+/*
+*   File: integrator.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Bulk position update for packed entity arrays. The wrap is done with compare masks instead of
+*   branches: x < 0 adds SCREEN_WIDTH, then x >= SCREEN_WIDTH subtracts it, exactly like the scalar code.
+*/
+
+#include "integrator.h"
+#include "constants.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ASTEROIDS_X86 1
+#include <immintrin.h>
+#endif
+
+// ===================== Scalar ==============================================================
+
+static void integrateScalar(double* x, double* y, const double* vx, const double* vy, int start, int n) {
+    for (int i = start; i < n; i++) {
+        double nx = x[i] + vx[i];
+        double ny = y[i] + vy[i];
+
+        if (nx < 0) nx += SCREEN_WIDTH;
+        if (nx >= SCREEN_WIDTH) nx -= SCREEN_WIDTH;
+        if (ny < 0) ny += SCREEN_HEIGHT;
+        if (ny >= SCREEN_HEIGHT) ny -= SCREEN_HEIGHT;
+
+        x[i] = nx;
+        y[i] = ny;
+    }
+}
+
+#ifdef ASTEROIDS_X86
+
+// ===================== SSE2 (2 entities per step) ==========================================
+
+__attribute__((target("sse2")))
+static __m128d wrapSse2(__m128d v, __m128d zero, __m128d size) {
+    v = _mm_add_pd(v, _mm_and_pd(_mm_cmplt_pd(v, zero), size));
+    v = _mm_sub_pd(v, _mm_and_pd(_mm_cmpge_pd(v, size), size));
+    return v;
+}
+
+__attribute__((target("sse2")))
+static void integrateSse2(double* x, double* y, const double* vx, const double* vy, int n) {
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d width = _mm_set1_pd(SCREEN_WIDTH);
+    const __m128d height = _mm_set1_pd(SCREEN_HEIGHT);
+
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d nx = _mm_add_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(vx + i));
+        __m128d ny = _mm_add_pd(_mm_loadu_pd(y + i), _mm_loadu_pd(vy + i));
+
+        _mm_storeu_pd(x + i, wrapSse2(nx, zero, width));
+        _mm_storeu_pd(y + i, wrapSse2(ny, zero, height));
+    }
+
+    integrateScalar(x, y, vx, vy, i, n);
+}
+
+// ===================== AVX2 (4 entities per step) ==========================================
+
+__attribute__((target("avx2")))
+static __m256d wrapAvx2(__m256d v, __m256d zero, __m256d size) {
+    v = _mm256_add_pd(v, _mm256_and_pd(_mm256_cmp_pd(v, zero, _CMP_LT_OQ), size));
+    v = _mm256_sub_pd(v, _mm256_and_pd(_mm256_cmp_pd(v, size, _CMP_GE_OQ), size));
+    return v;
+}
+
+__attribute__((target("avx2")))
+static void integrateAvx2(double* x, double* y, const double* vx, const double* vy, int n) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d width = _mm256_set1_pd(SCREEN_WIDTH);
+    const __m256d height = _mm256_set1_pd(SCREEN_HEIGHT);
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d nx = _mm256_add_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(vx + i));
+        __m256d ny = _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_loadu_pd(vy + i));
+
+        _mm256_storeu_pd(x + i, wrapAvx2(nx, zero, width));
+        _mm256_storeu_pd(y + i, wrapAvx2(ny, zero, height));
+    }
+
+    // Clear the upper halves before going back to SSE code (libm, the scalar tail),
+    // otherwise every later SSE instruction pays the AVX transition penalty
+    _mm256_zeroupper();
+
+    integrateScalar(x, y, vx, vy, i, n);
+}
+
+#endif
+
+// ===================== Dispatch ============================================================
+
+bool isIntegratorSupported(IntegratorKind kind) {
+#ifdef ASTEROIDS_X86
+    if (kind == INTEGRATOR_AVX2) return __builtin_cpu_supports("avx2");
+    if (kind == INTEGRATOR_SSE2) return __builtin_cpu_supports("sse2");
+#endif
+    return kind == INTEGRATOR_SCALAR;
+}
+
+IntegratorKind getBestIntegrator() {
+    static const IntegratorKind best =
+        isIntegratorSupported(INTEGRATOR_AVX2) ? INTEGRATOR_AVX2 :
+        isIntegratorSupported(INTEGRATOR_SSE2) ? INTEGRATOR_SSE2 :
+        INTEGRATOR_SCALAR;
+    return best;
+}
+
+void integratePositionsWith(IntegratorKind kind, double* x, double* y, const double* vx, const double* vy, int n) {
+    if (!isIntegratorSupported(kind))
+        kind = INTEGRATOR_SCALAR;
+
+#ifdef ASTEROIDS_X86
+    if (kind == INTEGRATOR_AVX2) {
+        integrateAvx2(x, y, vx, vy, n);
+        return;
+    }
+    if (kind == INTEGRATOR_SSE2) {
+        integrateSse2(x, y, vx, vy, n);
+        return;
+    }
+#endif
+
+    integrateScalar(x, y, vx, vy, 0, n);
+}
+
+void integratePositions(double* x, double* y, const double* vx, const double* vy, int n) {
+    integratePositionsWith(getBestIntegrator(), x, y, vx, vy, n);
+}
+
+const char* getIntegratorName(IntegratorKind kind) {
+    switch (kind) {
+        case INTEGRATOR_AVX2: return "avx2";
+        case INTEGRATOR_SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
@@ -0,0 +1,58 @@
+/*
+*   File: integrator.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Bulk position update for packed entity arrays. Adds each velocity to its position and wraps around
+*   the screen in one pass, using AVX2 or SSE2 when the CPU has it and a plain loop otherwise.
+*
+*/
+
+#ifndef INTEGRATOR_H
+#define INTEGRATOR_H
+
+enum IntegratorKind {
+    INTEGRATOR_SCALAR,
+    INTEGRATOR_SSE2,
+    INTEGRATOR_AVX2
+};
+
+/**
+ * Moves n entities by one tick and wraps them onto the screen, with the same result as
+ * SpaceObject::updatePosition + setLocation. Uses the best kernel this CPU supports.
+ *
+ * @param x Packed x coordinates, updated in place
+ * @param y Packed y coordinates, updated in place
+ * @param vx Packed x velocities
+ * @param vy Packed y velocities
+ * @param n Number of entities
+ */
+void integratePositions(double* x, double* y, const double* vx, const double* vy, int n);
+
+/**
+ * Same as integratePositions, but with a specific kernel (for benchmarks and comparisons).
+ * Falls back to the scalar kernel if the CPU does not support the one asked for.
+ *
+ * @param kind Kernel to run
+ */
+void integratePositionsWith(IntegratorKind kind, double* x, double* y, const double* vx, const double* vy, int n);
+
+/**
+ * @return The kernel integratePositions picked for this CPU
+ */
+IntegratorKind getBestIntegrator();
+
+/**
+ * @param kind Kernel to check
+ * @return true if this CPU can run it
+ */
+bool isIntegratorSupported(IntegratorKind kind);
+
+/**
+ * @param kind Kernel
+ * @return Short name ("scalar", "sse2", "avx2")
+ */
+const char* getIntegratorName(IntegratorKind kind);
+
+#endif
@@ -0,0 +1,226 @@
+/*
+*   File: kernels.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Compile-time kinds and per-kind kernels. SpaceObject decides what it is on every call (draw, move,
+*   turn, thrust and explode all check type); here each kind is a tag type whose constexpr traits say what it can
+*   do and which fields it has, and every kernel is a template on the kind. A loop over one store or one ship phase
+*   compiles down to only what that kind does, and using a kernel on a kind that can't (thrusting an asteroid) is a
+*   compile error instead of a silent no-op.
+*
+*/
+
+#ifndef KERNELS_H
+#define KERNELS_H
+#include "constants.h"
+#include "spaceObject.h"
+#include "integrator.h"
+#include <cmath>
+
+// ===================== Kinds ==============================================================
+
+struct ShipKind {
+    static constexpr SpaceObjType type = SHIP;
+    static constexpr bool moves = true;
+    static constexpr bool turns = true;
+    static constexpr bool thrusts = true;
+    static constexpr bool hasAngle = true;
+    static constexpr bool hasShape = false;
+};
+
+struct AsteroidKind {
+    static constexpr SpaceObjType type = ASTEROID;
+    static constexpr bool moves = true;
+    static constexpr bool turns = false;
+    static constexpr bool thrusts = false;
+    static constexpr bool hasAngle = false;     // never rotates, the outline is enough
+    static constexpr bool hasShape = true;
+};
+
+struct PhotonKind {
+    static constexpr SpaceObjType type = PHOTON_TORPEDO;
+    static constexpr bool moves = true;
+    static constexpr bool turns = false;
+    static constexpr bool thrusts = true;       // launched along its angle
+    static constexpr bool hasAngle = true;
+    static constexpr bool hasShape = false;
+};
+
+// The ship once it has been hit: stays where it was and grows until it is gone
+struct ExplosionKind {
+    static constexpr SpaceObjType type = SHIP_EXPLODING;
+    static constexpr bool moves = false;
+    static constexpr bool turns = false;
+    static constexpr bool thrusts = false;
+    static constexpr bool hasAngle = true;
+    static constexpr bool hasShape = false;
+};
+
+// ===================== Ship storage =======================================================
+
+/**
+ * Everything the simulation keeps for the ship, and nothing else (no draw outline, no draw counter, no countdown:
+ * the World's timer wheel does the timing).
+ * type is the phase: SHIP flies, SHIP_EXPLODING grows in place, SHIP_GONE waits for a respawn.
+ */
+struct ShipState {
+    SpaceObjType type = SHIP;
+    Point location = {0.0, 0.0};
+    Point velocity = {0.0, 0.0};
+    double radius = SHIP_RADIUS;
+    double angle = 0.0;
+    int age = 0;
+    bool invincible = false;
+};
+
+// ===================== Kernels ============================================================
+
+/**
+ * Wraps a point back onto the screen (same as SpaceObject::setLocation).
+ *
+ * @param p Point to wrap, at most one screen outside
+ */
+inline void wrapLocation(Point& p) {
+    if (p.x < 0) p.x += SCREEN_WIDTH;
+    if (p.x >= SCREEN_WIDTH) p.x -= SCREEN_WIDTH;
+    if (p.y < 0) p.y += SCREEN_HEIGHT;
+    if (p.y >= SCREEN_HEIGHT) p.y -= SCREEN_HEIGHT;
+}
+
+/**
+ * @param p Point to check
+ * @return True if p is on the screen, where wrapLocation() leaves everything (false for NaN)
+ */
+inline bool isOnScreen(Point p) {
+    return p.x >= 0 && p.x < SCREEN_WIDTH && p.y >= 0 && p.y < SCREEN_HEIGHT;
+}
+
+/**
+ * @param v Velocity to check
+ * @return True if one tick of it can't carry anything more than a screen off, so wrapLocation() still brings it
+ *         back (false for NaN and infinity)
+ */
+inline bool isWrappable(Point v) {
+    return std::fabs(v.x) < SCREEN_WIDTH && std::fabs(v.y) < SCREEN_HEIGHT;
+}
+
+/**
+ * Whether an entity of this kind can be this size: an asteroid is one of the three sizes it splits through, a
+ * torpedo always the same.
+ *
+ * @param r Radius to check
+ * @return True if the World ever makes one this size
+ */
+template <typename Kind>
+inline bool isKnownRadius(double r) {
+    static_assert(Kind::type == ASTEROID || Kind::type == PHOTON_TORPEDO, "only stored kinds have fixed sizes");
+
+    if constexpr (Kind::type == ASTEROID) {
+        return r == 25.0 || r == 12.5 || r == 6.25;
+    } else {
+        return r == 2.0;
+    }
+}
+
+/**
+ * Turns by delta degrees, kept in [0, 360).
+ *
+ * @param angle Angle to change
+ * @param delta Degrees to turn (positive is clockwise on screen)
+ */
+template <typename Kind>
+inline void turn(double& angle, double delta) {
+    static_assert(Kind::turns, "this kind can't turn");
+
+    angle += delta;
+    if (angle >= 360.0) angle -= 360.0;
+    if (angle < 0.0) angle += 360.0;
+}
+
+/**
+ * Pushes along the facing angle, capped at MAX_SPEED.
+ *
+ * @param angle Facing, degrees
+ * @param thrustAmount Speed added along it
+ * @param vx Velocity to change
+ * @param vy
+ */
+template <typename Kind>
+inline void thrust(double angle, double thrustAmount, double& vx, double& vy) {
+    static_assert(Kind::thrusts, "this kind can't thrust");
+
+    double angleRad = angle * 3.14159265 / 180.0;
+    vx += std::cos(angleRad) * thrustAmount;
+    vy += std::sin(angleRad) * thrustAmount;
+
+    double speed = std::sqrt(vx * vx + vy * vy);
+
+    if (speed > MAX_SPEED) {
+        vx = (vx / speed) * MAX_SPEED;
+        vy = (vy / speed) * MAX_SPEED;
+    }
+}
+
+/**
+ * One tick for the ship in the phase Kind: ages it, and moves and wraps it if that phase moves.
+ *
+ * @param ship Ship to advance
+ */
+template <typename Kind>
+inline void advance(ShipState& ship) {
+    ship.age++;
+
+    if constexpr (Kind::moves) {
+        ship.location.x += ship.velocity.x;
+        ship.location.y += ship.velocity.y;
+        wrapLocation(ship.location);
+    }
+}
+
+/**
+ * One tick for a packed batch of one kind: moves and wraps every entity (vectorized), then ages them.
+ *
+ * @param x Packed positions, updated in place
+ * @param y
+ * @param vx Packed velocities
+ * @param vy
+ * @param age Packed ages, updated in place
+ * @param n Entities in the batch
+ */
+template <typename Kind>
+inline void advanceBatch(double* x, double* y, const double* vx, const double* vy, int* age, int n) {
+    static_assert(Kind::moves, "batches are only kept for moving kinds");
+
+    integratePositions(x, y, vx, vy, n);
+
+    for (int i = 0; i < n; i++) {
+        age[i]++;
+    }
+}
+
+/**
+ * Stops the ship where it is and starts the explosion phase.
+ *
+ * @param ship Flying ship
+ */
+inline void explode(ShipState& ship) {
+    ship.type = ExplosionKind::type;
+    ship.velocity = {0.0, 0.0};
+}
+
+/**
+ * Explosion radius after some ticks of growth.
+ *
+ * @param ticks Ticks since the ship was hit
+ * @return Radius to draw and collide with
+ */
+template <typename Kind>
+inline double explosionRadius(long ticks) {
+    static_assert(Kind::type == SHIP_EXPLODING, "only the explosion grows");
+
+    return SHIP_RADIUS + SHIP_EXPLOSION_GROWTH * ticks;
+}
+
+#endif
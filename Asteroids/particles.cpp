@@ -0,0 +1,216 @@
+/*
+*   File: particles.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Debris and sparks. Emitting writes at the ring's head, updating is one SSE pass over packed float
+*   arrays, and building writes straight into a point batch that keeps its capacity between frames.
+*/
+
+#include "particles.h"
+#include "constants.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ASTEROIDS_X86 1
+#include <immintrin.h>
+#endif
+
+ParticleSystem::ParticleSystem(int capacity) : points(sf::PrimitiveType::Points), rng(7, 0) {
+    cap = capacity;
+    head = 0;
+    used = 0;
+    liveCount = 0;
+    effectsSeen = 0;
+
+    posX.resize(cap);
+    posY.resize(cap);
+    velX.resize(cap);
+    velY.resize(cap);
+    life.assign(cap, 0.f);
+    fade.resize(cap);
+    color.resize(cap);
+
+    // Sized for a full ring once, build() only ever shrinks and regrows it within that
+    points.resize(cap);
+}
+
+/**
+ * Random point in the circle and random outward speed, on top of the velocity of what burst
+ */
+void ParticleSystem::emit(float x, float y, float vx, float vy, float radius, int count, float speed,
+                          sf::Color base) {
+    for (int k = 0; k < count; k++) {
+        int i = head;
+        head = head + 1 == cap ? 0 : head + 1;
+        used = std::max(used, i + 1);
+
+        float angle = static_cast<float>(rng.nextDouble()) * 2.f * 3.14159265f;
+        float c = std::cos(angle);
+        float s = std::sin(angle);
+        float start = radius * static_cast<float>(rng.nextDouble());
+        float out = speed * (0.2f + 0.8f * static_cast<float>(rng.nextDouble()));
+        float seconds = PARTICLE_LIFE_MIN +
+                        (PARTICLE_LIFE_MAX - PARTICLE_LIFE_MIN) * static_cast<float>(rng.nextDouble());
+
+        posX[i] = x + c * start;
+        posY[i] = y + s * start;
+        velX[i] = vx + c * out;
+        velY[i] = vy + s * out;
+        life[i] = seconds;
+        fade[i] = 255.f / seconds;
+
+        // Brighter or darker by up to a quarter
+        float shade = 0.75f + 0.5f * static_cast<float>(rng.nextDouble());
+        color[i] = sf::Color(static_cast<std::uint8_t>(std::min(255.f, base.r * shade)),
+                             static_cast<std::uint8_t>(std::min(255.f, base.g * shade)),
+                             static_cast<std::uint8_t>(std::min(255.f, base.b * shade)));
+    }
+}
+
+/**
+ * Only effects newer than the last call; if more happened than the snapshot keeps, the oldest are skipped
+ */
+void ParticleSystem::addEffects(const Snapshot& snapshot) {
+    long first = std::max(effectsSeen, snapshot.effectCount - EFFECT_HISTORY);
+
+    for (long n = first; n < snapshot.effectCount; n++) {
+        const Effect& e = snapshot.effects[n % EFFECT_HISTORY];
+        float vx = e.velX * TICK_RATE;
+        float vy = e.velY * TICK_RATE;
+
+        if (e.kind == EFFECT_SHIP_EXPLODE) {
+            emit(e.x, e.y, vx, vy, e.radius, PARTICLES_PER_EXPLOSION / 2, 220.f, sf::Color(255, 90, 30));
+            emit(e.x, e.y, vx, vy, e.radius, PARTICLES_PER_EXPLOSION / 2, 120.f, sf::Color(255, 220, 80));
+        } else {
+            int count = PARTICLES_PER_BREAK + static_cast<int>(e.radius * PARTICLES_PER_BREAK_RADIUS);
+            emit(e.x, e.y, vx, vy, e.radius, count, 90.f, sf::Color(150, 140, 125));
+        }
+    }
+
+    effectsSeen = snapshot.effectCount;
+}
+
+// ===================== Update sweep ========================================================
+
+/**
+ * Scalar sweep over [start, n): drag, move, wrap, age. Returns how many are still alive.
+ */
+static int updateScalar(float* px, float* py, float* vx, float* vy, float* life, int start, int n,
+                        float seconds, float damping) {
+    const float width = static_cast<float>(SCREEN_WIDTH);
+    const float height = static_cast<float>(SCREEN_HEIGHT);
+    int alive = 0;
+
+    for (int i = start; i < n; i++) {
+        vx[i] *= damping;
+        vy[i] *= damping;
+
+        float x = px[i] + vx[i] * seconds;
+        float y = py[i] + vy[i] * seconds;
+        if (x < 0.f) x += width;
+        if (x >= width) x -= width;
+        if (y < 0.f) y += height;
+        if (y >= height) y -= height;
+        px[i] = x;
+        py[i] = y;
+
+        life[i] -= seconds;
+        if (life[i] > 0.f) alive++;
+    }
+
+    return alive;
+}
+
+#ifdef ASTEROIDS_X86
+
+__attribute__((target("sse2")))
+static __m128 wrapParticlesSse2(__m128 v, __m128 zero, __m128 size) {
+    v = _mm_add_ps(v, _mm_and_ps(_mm_cmplt_ps(v, zero), size));
+    v = _mm_sub_ps(v, _mm_and_ps(_mm_cmpge_ps(v, size), size));
+    return v;
+}
+
+/**
+ * Same sweep four particles at a time (the compiler won't vectorize the wraps on its own), scalar for the tail
+ */
+__attribute__((target("sse2")))
+static int updateSse2(float* px, float* py, float* vx, float* vy, float* life, int n, float seconds, float damping) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 width = _mm_set1_ps(static_cast<float>(SCREEN_WIDTH));
+    const __m128 height = _mm_set1_ps(static_cast<float>(SCREEN_HEIGHT));
+    const __m128 dt = _mm_set1_ps(seconds);
+    const __m128 drag = _mm_set1_ps(damping);
+    int alive = 0;
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 nvx = _mm_mul_ps(_mm_loadu_ps(vx + i), drag);
+        __m128 nvy = _mm_mul_ps(_mm_loadu_ps(vy + i), drag);
+        __m128 nx = _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(nvx, dt));
+        __m128 ny = _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(nvy, dt));
+        __m128 nl = _mm_sub_ps(_mm_loadu_ps(life + i), dt);
+
+        _mm_storeu_ps(vx + i, nvx);
+        _mm_storeu_ps(vy + i, nvy);
+        _mm_storeu_ps(px + i, wrapParticlesSse2(nx, zero, width));
+        _mm_storeu_ps(py + i, wrapParticlesSse2(ny, zero, height));
+        _mm_storeu_ps(life + i, nl);
+
+        alive += __builtin_popcount(_mm_movemask_ps(_mm_cmpgt_ps(nl, zero)));
+    }
+
+    return alive + updateScalar(px, py, vx, vy, life, i, n, seconds, damping);
+}
+
+#endif
+
+void ParticleSystem::update(float seconds) {
+    float damping = std::exp(-PARTICLE_DRAG * seconds);
+
+    // Dead particles are swept too; skipping them would cost a branch each and save nothing
+#ifdef ASTEROIDS_X86
+    int alive = updateSse2(posX.data(), posY.data(), velX.data(), velY.data(), life.data(), used, seconds, damping);
+#else
+    int alive = updateScalar(posX.data(), posY.data(), velX.data(), velY.data(), life.data(), 0, used, seconds,
+                             damping);
+#endif
+
+    // Everything burnt out: start the ring over so the sweeps go back to covering nothing
+    if (alive == 0) {
+        used = 0;
+        head = 0;
+    }
+}
+
+void ParticleSystem::build() {
+    // Regrowing within the capacity reserved up front, no allocation
+    points.resize(used);
+    int n = 0;
+
+    for (int i = 0; i < used; i++) {
+        if (life[i] <= 0.f)
+            continue;
+
+        sf::Vertex& v = points[n++];
+        v.position = {posX[i], posY[i]};
+        v.color = color[i];
+        v.color.a = static_cast<std::uint8_t>(std::min(255.f, life[i] * fade[i]));
+    }
+
+    points.resize(n);
+    liveCount = n;
+}
+
+void ParticleSystem::draw(sf::RenderWindow& window) const {
+    if (liveCount > 0) {
+        window.draw(points);
+    }
+}
+
+int ParticleSystem::getLiveCount() const {
+    return liveCount;
+}
@@ -0,0 +1,115 @@
+/*
+*   File: particles.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Debris and sparks for asteroid breaks and ship explosions. Particles live in a fixed structure-of-
+*   arrays ring (new ones overwrite the oldest once it is full), are moved in one linear sweep per frame, and are
+*   drawn as a single batch of points. Purely visual: runs on the render thread from the Snapshot's effects, so the
+*   simulation and its replays never see it.
+*
+*/
+
+#ifndef PARTICLES_H
+#define PARTICLES_H
+#include "snapshot.h"
+#include "random.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Ring size, the most particles alive at once
+const int PARTICLE_CAPACITY = 1 << 16;
+
+// Particles per asteroid break (base + per pixel of radius: 300 for a big one, 150 for the smallest) and per ship
+const int PARTICLES_PER_BREAK = 100;
+const int PARTICLES_PER_BREAK_RADIUS = 8;
+const int PARTICLES_PER_EXPLOSION = 600;
+
+// Velocity lost per second (exponential drag) and the range of lifetimes, in seconds
+const float PARTICLE_DRAG = 1.5f;
+const float PARTICLE_LIFE_MIN = 0.4f;
+const float PARTICLE_LIFE_MAX = 1.4f;
+
+class ParticleSystem {
+    private:
+
+    int cap;
+    int head;       // next slot to write, wraps round to the oldest
+    int used;       // slots [0, used) have been written since the ring was last empty
+
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> life;       // seconds left, <= 0 when dead
+    std::vector<float> fade;       // 255 / starting life, so alpha is life * fade
+    std::vector<sf::Color> color;
+
+    sf::VertexArray points;
+    int liveCount;
+
+    // Spread and colour variation only, never touches the simulation's streams
+    Pcg32 rng;
+
+    // Snapshot effects up to here have been emitted
+    long effectsSeen;
+
+    public:
+
+    /**
+     * Allocates the ring and the vertex batch once.
+     *
+     * @param capacity Most particles alive at once
+    */
+    explicit ParticleSystem(int capacity = PARTICLE_CAPACITY);
+
+    /**
+     * Sprays particles out of a circle.
+     *
+     * @param x Center x
+     * @param y Center y
+     * @param velX Velocity of what burst, pixels per second (every particle inherits it)
+     * @param velY
+     * @param radius Particles start anywhere inside this radius
+     * @param count How many to emit (past the ring size, the oldest are overwritten)
+     * @param speed Fastest outward speed, pixels per second
+     * @param base Colour to vary around
+    */
+    void emit(float x, float y, float velX, float velY, float radius, int count, float speed, sf::Color base);
+
+    /**
+     * Emits debris for every effect in the snapshot that hasn't been emitted yet.
+     *
+     * @param snapshot Newest snapshot from the sim thread
+    */
+    void addEffects(const Snapshot& snapshot);
+
+    /**
+     * Moves, slows and ages every particle in one sweep, and wraps them around the screen.
+     *
+     * @param seconds Time since the last update
+    */
+    void update(float seconds);
+
+    /**
+     * Writes every live particle into the point batch (dead ones are skipped).
+    */
+    void build();
+
+    /**
+     * Submits the point batch in one draw call.
+     *
+     * @param window SFML render window to draw to
+    */
+    void draw(sf::RenderWindow& window) const;
+
+    /**
+     * @return Particles in the last build()
+    */
+    int getLiveCount() const;
+
+    int capacity() const { return cap; }
+
+};
+#endif
@@ -0,0 +1,162 @@
+/*
+*   File: profiler.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Per-phase frame profiler with a rolling history and Chrome trace export.
+*/
+
+#include "profiler.h"
+#include <algorithm>
+#include <cstdio>
+
+/**
+ * Shared time origin, so traces from different threads line up
+ */
+static std::chrono::steady_clock::time_point getTraceEpoch() {
+    static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    return epoch;
+}
+
+Profiler::Profiler(int traceThread) : trace(TRACE_CAPACITY) {
+    origin = getTraceEpoch();
+    frameStartUs = 0;
+    this->traceThread = traceThread;
+    historyCount = 0;
+    historyNext = 0;
+    traceWritten = 0;
+
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        phaseUs[p] = 0;
+    }
+}
+
+double Profiler::nowUs() const {
+    return std::chrono::duration<double, std::micro>(Clock::now() - origin).count();
+}
+
+void Profiler::addTraceEvent(int phase, double startUs, double durationUs) {
+    trace[traceWritten % TRACE_CAPACITY] = {phase, startUs, durationUs};
+    traceWritten++;
+}
+
+void Profiler::beginFrame() {
+    frameStartUs = nowUs();
+
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        phaseUs[p] = 0;
+    }
+}
+
+void Profiler::endFrame() {
+    double endUs = nowUs();
+    addTraceEvent(PHASE_COUNT, frameStartUs, endUs - frameStartUs);
+
+    frameMs[historyNext] = (endUs - frameStartUs) / 1000.0;
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        phaseMs[p][historyNext] = phaseUs[p] / 1000.0;
+    }
+
+    historyNext = (historyNext + 1) % PROFILE_HISTORY;
+    if (historyCount < PROFILE_HISTORY) historyCount++;
+}
+
+void Profiler::record(ProfilePhase phase, double startUs, double endUs) {
+    phaseUs[phase] += endUs - startUs;
+    addTraceEvent(phase, startUs, endUs - startUs);
+}
+
+FrameStats Profiler::getFrameStats() const {
+    FrameStats stats = {0, 0, 0, 0};
+    if (historyCount == 0)
+        return stats;
+
+    double sorted[PROFILE_HISTORY];
+    std::copy(frameMs, frameMs + historyCount, sorted);
+    std::sort(sorted, sorted + historyCount);
+
+    double total = 0;
+    for (int i = 0; i < historyCount; i++) {
+        total += sorted[i];
+    }
+
+    stats.minMs = sorted[0];
+    stats.avgMs = total / historyCount;
+    stats.p99Ms = sorted[std::min(historyCount - 1, (historyCount * 99) / 100)];
+    stats.maxMs = sorted[historyCount - 1];
+    return stats;
+}
+
+double Profiler::getPhaseAverageMs(ProfilePhase phase) const {
+    if (historyCount == 0)
+        return 0;
+
+    double total = 0;
+    for (int i = 0; i < historyCount; i++) {
+        total += phaseMs[phase][i];
+    }
+    return total / historyCount;
+}
+
+const char* Profiler::getPhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case PHASE_EVENTS: return "events";
+        case PHASE_CONTROLS: return "controls";
+        case PHASE_UPDATE: return "update";
+        case PHASE_COLLISIONS: return "collisions";
+        case PHASE_DRAW: return "draw";
+        case PHASE_DISPLAY: return "display";
+        default: return "frame";
+    }
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    const Profiler* self = this;
+    return writeChromeTrace(path, &self, 1);
+}
+
+/**
+ * Complete ("X") events, each profiler's frames on one row and its phases on the next
+ */
+bool Profiler::writeChromeTrace(const std::string& path, const Profiler* const* profilers, int count) {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (file == nullptr)
+        return false;
+
+    std::fprintf(file, "{\"traceEvents\":[\n");
+    bool firstEvent = true;
+
+    for (int k = 0; k < count; k++) {
+        const Profiler& profiler = *profilers[k];
+        long first = profiler.traceWritten > TRACE_CAPACITY ? profiler.traceWritten - TRACE_CAPACITY : 0;
+
+        for (long i = first; i < profiler.traceWritten; i++) {
+            const TraceEvent& e = profiler.trace[i % TRACE_CAPACITY];
+            int row = e.phase == PHASE_COUNT ? profiler.traceThread : profiler.traceThread + 1;
+
+            std::fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+                         firstEvent ? "" : ",\n", getPhaseName(static_cast<ProfilePhase>(e.phase)),
+                         e.startUs, e.durationUs, row);
+            firstEvent = false;
+        }
+    }
+
+    std::fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    std::fclose(file);
+    return true;
+}
+
+// ===================== ScopedTimer ========================================================
+
+ScopedTimer::ScopedTimer(Profiler* profiler, ProfilePhase phase) {
+    this->profiler = profiler;
+    this->phase = phase;
+    startUs = profiler != nullptr ? profiler -> nowUs() : 0;
+}
+
+ScopedTimer::~ScopedTimer() {
+    if (profiler != nullptr) {
+        profiler -> record(phase, startUs, profiler -> nowUs());
+    }
+}
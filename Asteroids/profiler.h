@@ -0,0 +1,161 @@
+/*
+*   File: profiler.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Per-phase frame profiler. Scoped timers around each phase of the game loop feed a rolling
+*   frame-time history (min/avg/p99) and a ring buffer of trace events that can be saved in Chrome trace format.
+*
+*/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+#include <chrono>
+#include <string>
+#include <vector>
+
+enum ProfilePhase {
+    PHASE_EVENTS,
+    PHASE_CONTROLS,
+    PHASE_UPDATE,
+    PHASE_COLLISIONS,
+    PHASE_DRAW,
+    PHASE_DISPLAY,
+    PHASE_COUNT
+};
+
+// Frames kept for min/avg/p99, and trace events kept for export (oldest are overwritten)
+const int PROFILE_HISTORY = 240;
+const int TRACE_CAPACITY = 1 << 18;
+
+struct FrameStats {
+    double minMs;
+    double avgMs;
+    double p99Ms;
+    double maxMs;
+};
+
+class Profiler {
+    private:
+
+    typedef std::chrono::steady_clock Clock;
+
+    struct TraceEvent {
+        int phase;         // PHASE_COUNT marks a whole frame
+        double startUs;
+        double durationUs;
+    };
+
+    Clock::time_point origin;
+    double frameStartUs;
+
+    // Chrome trace rows: frames go on traceThread, phases on traceThread + 1
+    int traceThread;
+
+    // Time spent in each phase during the current frame
+    double phaseUs[PHASE_COUNT];
+
+    // Rolling history, PROFILE_HISTORY frames
+    double frameMs[PROFILE_HISTORY];
+    double phaseMs[PHASE_COUNT][PROFILE_HISTORY];
+    int historyCount;
+    int historyNext;
+
+    std::vector<TraceEvent> trace;
+    long traceWritten;
+
+    void addTraceEvent(int phase, double startUs, double durationUs);
+
+    public:
+
+    /**
+     * Starts an empty history. Use one profiler per thread; every profiler shares the same time origin so their
+     * traces line up when saved together.
+     *
+     * @param traceThread Trace row for frames (phases use the next row)
+    */
+    explicit Profiler(int traceThread = 1);
+
+    /**
+     * @return Microseconds since the first profiler was created
+    */
+    double nowUs() const;
+
+    /**
+     * Marks the start of a frame (or tick, when running headless).
+    */
+    void beginFrame();
+
+    /**
+     * Marks the end of a frame and pushes its total and per-phase times into the history.
+    */
+    void endFrame();
+
+    /**
+     * Adds a measured interval to a phase of the current frame.
+     *
+     * @param phase Which part of the loop ran
+     * @param startUs Start time from nowUs()
+     * @param endUs End time from nowUs()
+    */
+    void record(ProfilePhase phase, double startUs, double endUs);
+
+    /**
+     * @return min/avg/p99/max frame time over the last PROFILE_HISTORY frames (all 0 before the first frame)
+    */
+    FrameStats getFrameStats() const;
+
+    /**
+     * @param phase Phase to look up
+     * @return Average time spent in that phase per frame over the history, in milliseconds
+    */
+    double getPhaseAverageMs(ProfilePhase phase) const;
+
+    /**
+     * @param phase Phase to name
+     * @return Lowercase label ("events", "update", ...)
+    */
+    static const char* getPhaseName(ProfilePhase phase);
+
+    /**
+     * Saves the buffered trace events as a Chrome trace (chrome://tracing, Perfetto).
+     *
+     * @param path File to write
+     * @return true if the file was written
+    */
+    bool writeChromeTrace(const std::string& path) const;
+
+    /**
+     * Saves the trace events of several profilers (one per thread) into one Chrome trace.
+     * None of them may be recording while this runs.
+     *
+     * @param path File to write
+     * @param profilers Profilers to save
+     * @param count Number of profilers
+     * @return true if the file was written
+    */
+    static bool writeChromeTrace(const std::string& path, const Profiler* const* profilers, int count);
+
+};
+
+/**
+ * Times the enclosing scope and records it on destruction. Does nothing if profiler is nullptr.
+ */
+class ScopedTimer {
+    private:
+
+    Profiler* profiler;
+    ProfilePhase phase;
+    double startUs;
+
+    public:
+
+    ScopedTimer(Profiler* profiler, ProfilePhase phase);
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+};
+#endif
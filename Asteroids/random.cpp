@@ -0,0 +1,30 @@
+/*
+*   File: random.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: PCG32 seeding and restoring. The per-draw functions are inline in random.h.
+*/
+
+#include "random.h"
+
+Pcg32::Pcg32(std::uint64_t seed, std::uint64_t stream) {
+    this->seed(seed, stream);
+}
+
+/**
+ * Reference pcg32_srandom_r: pick the stream, then mix the seed in
+ */
+void Pcg32::seed(std::uint64_t seed, std::uint64_t stream) {
+    state = 0;
+    increment = (stream << 1) | 1;
+    next();
+    state += seed;
+    next();
+}
+
+void Pcg32::setState(std::uint64_t savedState, std::uint64_t savedIncrement) {
+    state = savedState;
+    increment = savedIncrement | 1;
+}
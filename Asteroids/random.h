@@ -0,0 +1,99 @@
+/*
+*   File: random.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Small seedable PCG32 generator (O'Neill, pcg-random.org). Every generator carries its own state and
+*   stream, so spawning, shapes and splits each draw from an independent sequence and no call in one place can shift
+*   the numbers another place gets.
+*
+*/
+
+#ifndef RANDOM_H
+#define RANDOM_H
+#include <cstdint>
+
+// One stream per purpose, so adding draws to one never changes the others
+enum RandomStream {
+    STREAM_SPAWN = 1,
+    STREAM_SHAPE = 2,
+    STREAM_SPLIT = 3
+};
+
+class Pcg32 {
+    private:
+
+    std::uint64_t state;
+    std::uint64_t increment;   // always odd, selects the stream
+
+    public:
+
+    /**
+     * @param seed Starting point in the sequence
+     * @param stream Which of the 2^63 independent sequences to use
+    */
+    explicit Pcg32(std::uint64_t seed = 42, std::uint64_t stream = 0);
+
+    /**
+     * Restarts the generator, same as constructing a new one.
+     *
+     * @param seed Starting point in the sequence
+     * @param stream Which sequence to use
+    */
+    void seed(std::uint64_t seed, std::uint64_t stream);
+
+    /**
+     * @return Next 32 uniformly distributed bits
+    */
+    std::uint32_t next() {
+        std::uint64_t old = state;
+        state = old * 6364136223846793005ULL + increment;
+
+        std::uint32_t xorShifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+        std::uint32_t rot = static_cast<std::uint32_t>(old >> 59);
+        return (xorShifted >> rot) | (xorShifted << ((32 - rot) & 31));
+    }
+
+    /**
+     * Number in [0, bound) by multiply-shift instead of %: no division and no branch.
+     * The bias is at most bound / 2^32, far below anything the game can notice.
+     *
+     * @param bound Exclusive upper limit, at least 1
+     * @return Value in [0, bound)
+    */
+    std::uint32_t nextBelow(std::uint32_t bound) {
+        return static_cast<std::uint32_t>((static_cast<std::uint64_t>(next()) * bound) >> 32);
+    }
+
+    /**
+     * @param lo Smallest value
+     * @param hi Largest value (inclusive)
+     * @return Value in [lo, hi]
+    */
+    int nextInt(int lo, int hi) {
+        return lo + static_cast<int>(nextBelow(static_cast<std::uint32_t>(hi - lo + 1)));
+    }
+
+    /**
+     * @return Value in [0, 1) with 32 bits of precision
+    */
+    double nextDouble() {
+        return next() * (1.0 / 4294967296.0);
+    }
+
+    // ===================== Save / restore ====================================================
+
+    std::uint64_t getState() const { return state; }
+    std::uint64_t getIncrement() const { return increment; }
+
+    /**
+     * Restores a generator saved with getState()/getIncrement().
+     *
+     * @param savedState Value from getState()
+     * @param savedIncrement Value from getIncrement()
+    */
+    void setState(std::uint64_t savedState, std::uint64_t savedIncrement);
+
+};
+#endif
@@ -0,0 +1,162 @@
+/*
+*   File: renderer.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Batched renderer for the Asteroids clone. Same look as SpaceObject::draw, but every shape is
+*   written as triangles into one sf::VertexArray instead of building a new sf::Shape per object per frame.
+*   Objects move by exactly their velocity each tick (asteroid bounces change velocities before the move, never after
+*   it), so the previous tick's position is position - velocity. That keeps interpolation correct even after
+*   swap-remove has reordered the arrays between two snapshots.
+*/
+
+#include "renderer.h"
+#include "shapeLibrary.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+BatchRenderer::BatchRenderer() : triangles(sf::PrimitiveType::Triangles) {
+    for (int i = 0; i < CIRCLE_POINTS; i++) {
+        float angleRad = (2.f * 3.14159265f / CIRCLE_POINTS) * i;
+        circleCos[i] = std::cos(angleRad);
+        circleSin[i] = std::sin(angleRad);
+    }
+}
+
+void BatchRenderer::addTriangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color) {
+    triangles.append(sf::Vertex{a, color, {}});
+    triangles.append(sf::Vertex{b, color, {}});
+    triangles.append(sf::Vertex{c, color, {}});
+}
+
+/**
+ * Filled circle as a fan of triangles around the center
+ */
+void BatchRenderer::addCircle(sf::Vector2f center, float r, sf::Color color, int stride) {
+    for (int i = 0; i < CIRCLE_POINTS; i += stride) {
+        int j = (i + stride) % CIRCLE_POINTS;
+
+        addTriangle(center,
+                    {center.x + circleCos[i] * r, center.y + circleSin[i] * r},
+                    {center.x + circleCos[j] * r, center.y + circleSin[j] * r},
+                    color);
+    }
+}
+
+/**
+ * Position `behind` of a tick back along the velocity, wrapped back onto the screen
+ */
+static sf::Vector2f interpolate(double x, double y, double vx, double vy, float behind) {
+    double ix = x - vx * behind;
+    double iy = y - vy * behind;
+
+    if (ix < 0) ix += SCREEN_WIDTH;
+    if (ix >= SCREEN_WIDTH) ix -= SCREEN_WIDTH;
+    if (iy < 0) iy += SCREEN_HEIGHT;
+    if (iy >= SCREEN_HEIGHT) iy -= SCREEN_HEIGHT;
+
+    return {static_cast<float>(ix), static_cast<float>(iy)};
+}
+
+// ===================== ASTEROID =========================
+
+void BatchRenderer::addAsteroids(const Snapshot& snapshot, float behind) {
+    const sf::Color rockColor(120, 120, 120);
+    const ShapeLibrary& shapes = getShapeLibrary();
+
+    for (int i = 0; i < snapshot.asteroidCount; i++) {
+        sf::Vector2f center = interpolate(snapshot.asteroidX[i], snapshot.asteroidY[i],
+                                          snapshot.asteroidVelX[i], snapshot.asteroidVelY[i], behind);
+        float scale = static_cast<float>(snapshot.asteroidRadius[i]);
+
+        const float* ux = shapes.getX(snapshot.asteroidShape[i]);
+        const float* uy = shapes.getY(snapshot.asteroidShape[i]);
+
+        for (int k = 0; k < ASTEROID_POINTS; k++) {
+            int next = (k + 1) % ASTEROID_POINTS;
+
+            addTriangle(center,
+                        {center.x + ux[k] * scale, center.y + uy[k] * scale},
+                        {center.x + ux[next] * scale, center.y + uy[next] * scale},
+                        rockColor);
+        }
+    }
+}
+
+// ================= PHOTON TORPEDO ============================
+
+void BatchRenderer::addPhotons(const Snapshot& snapshot, float behind) {
+    for (int i = 0; i < snapshot.photonCount; i++) {
+        sf::Vector2f center = interpolate(snapshot.photonX[i], snapshot.photonY[i],
+                                          snapshot.photonVelX[i], snapshot.photonVelY[i], behind);
+
+        addCircle(center, static_cast<float>(snapshot.photonRadius[i]), sf::Color::Yellow, PHOTON_CIRCLE_STRIDE);
+    }
+}
+
+// ================== SHIP / EXPLOSION ============================
+
+void BatchRenderer::addShip(const Snapshot& snapshot, float behind) {
+    sf::Vector2f center = interpolate(snapshot.shipX, snapshot.shipY, snapshot.shipVelX, snapshot.shipVelY, behind);
+    float r = static_cast<float>(snapshot.shipRadius);
+
+    if (snapshot.shipType == SHIP_EXPLODING) {
+        addCircle(center, r, sf::Color::Red, 1);
+        return;
+    }
+
+    if (snapshot.shipType != SHIP)
+        return;
+
+    // Pulse alpha if invincible
+    sf::Color shipColor = sf::Color::White;
+    if (snapshot.shipInvincible) {
+        float t = static_cast<float>(snapshot.shipInvincibleTimer) * 0.25f;
+        int alpha = static_cast<int>(128 + std::sin(t) * 127);
+        if (alpha < 30) alpha = 30;   // keep it visible
+        if (alpha > 255) alpha = 255;
+
+        shipColor.a = static_cast<std::uint8_t>(alpha);
+    }
+
+    addCircle(center, r, shipColor, 1);
+
+    // Nose: radius long, 2 pixels wide, pointing along the ship's angle
+    // Shortest way round from the previous angle, so 359 -> 2 does not spin the long way
+    double turn = snapshot.shipAngle - snapshot.shipPrevAngle;
+    if (turn > 180.0) turn -= 360.0;
+    if (turn < -180.0) turn += 360.0;
+
+    double angle = snapshot.shipAngle - turn * behind;
+    float angleRad = static_cast<float>(angle) * 3.14159265f / 180.f;
+    sf::Vector2f along(std::cos(angleRad), std::sin(angleRad));
+    sf::Vector2f across(-along.y, along.x);
+
+    sf::Vector2f backLeft = center - across;
+    sf::Vector2f backRight = center + across;
+    sf::Vector2f frontLeft = backLeft + along * r;
+    sf::Vector2f frontRight = backRight + along * r;
+
+    addTriangle(backLeft, frontLeft, frontRight, sf::Color::Red);
+    addTriangle(backLeft, frontRight, backRight, sf::Color::Red);
+}
+
+void BatchRenderer::build(const Snapshot& snapshot, float alpha) {
+    triangles.clear();
+
+    float behind = 1.f - std::min(std::max(alpha, 0.f), 1.f);
+
+    addAsteroids(snapshot, behind);
+    addPhotons(snapshot, behind);
+    addShip(snapshot, behind);
+}
+
+void BatchRenderer::draw(sf::RenderWindow& window) const {
+    window.draw(triangles);
+}
+
+std::size_t BatchRenderer::getVertexCount() const {
+    return triangles.getVertexCount();
+}
@@ -0,0 +1,64 @@
+/*
+*   File: renderer.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Batched renderer for the Asteroids clone. Writes the ship, asteroids, photons and the explosion into
+*   one persistent triangle list and submits it with a single draw call, no matter how many objects are on screen.
+*   Draws from a Snapshot, interpolated between the last two ticks.
+*
+*/
+
+#ifndef RENDERER_H
+#define RENDERER_H
+#include "snapshot.h"
+#include <SFML/Graphics.hpp>
+
+// Points around a full circle (ship, explosion), photons use every 4th one
+const int CIRCLE_POINTS = 32;
+const int PHOTON_CIRCLE_STRIDE = 4;
+
+class BatchRenderer {
+    private:
+
+    sf::VertexArray triangles;
+
+    // cos/sin of each circle point, computed once
+    float circleCos[CIRCLE_POINTS];
+    float circleSin[CIRCLE_POINTS];
+
+    void addTriangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color);
+    void addCircle(sf::Vector2f center, float r, sf::Color color, int stride);
+
+    void addAsteroids(const Snapshot& snapshot, float behind);
+    void addPhotons(const Snapshot& snapshot, float behind);
+    void addShip(const Snapshot& snapshot, float behind);
+
+    public:
+
+    BatchRenderer();
+
+    /**
+     * Rebuilds the triangle list from a snapshot.
+     * The vertex buffer keeps its capacity, so this only allocates when the scene gets bigger than ever before.
+     *
+     * @param snapshot Tick to draw
+     * @param alpha How far from the previous tick (0) to this one (1) to draw moving objects
+    */
+    void build(const Snapshot& snapshot, float alpha);
+
+    /**
+     * Submits everything built by build() in one draw call.
+     *
+     * @param window SFML render window to draw to
+    */
+    void draw(sf::RenderWindow& window) const;
+
+    /**
+     * @return Number of vertices in the current batch
+    */
+    std::size_t getVertexCount() const;
+
+};
+#endif
@@ -0,0 +1,214 @@
+/*
+*   File: replay.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Deterministic input recording and replay. Files are written byte by byte in little endian order so a
+*   recording made on one machine replays on any other.
+*/
+
+#include "replay.h"
+#include <cstdio>
+
+// ============================================================
+// Input bits
+// ============================================================
+
+std::uint8_t packInput(const InputFrame& input) {
+    std::uint8_t bits = 0;
+    if (input.rotateLeft) bits |= INPUT_ROTATE_LEFT;
+    if (input.rotateRight) bits |= INPUT_ROTATE_RIGHT;
+    if (input.thrust) bits |= INPUT_THRUST;
+    if (input.fire) bits |= INPUT_FIRE;
+    if (input.restart) bits |= INPUT_RESTART;
+    return bits;
+}
+
+InputFrame unpackInput(std::uint8_t bits) {
+    InputFrame input;
+    input.rotateLeft = (bits & INPUT_ROTATE_LEFT) != 0;
+    input.rotateRight = (bits & INPUT_ROTATE_RIGHT) != 0;
+    input.thrust = (bits & INPUT_THRUST) != 0;
+    input.fire = (bits & INPUT_FIRE) != 0;
+    input.restart = (bits & INPUT_RESTART) != 0;
+    return input;
+}
+
+// ============================================================
+// Little endian helpers
+// ============================================================
+
+static void putU32(std::vector<unsigned char>& buffer, std::uint32_t value) {
+    for (int b = 0; b < 4; b++) {
+        buffer.push_back(static_cast<unsigned char>(value >> (8 * b)));
+    }
+}
+
+static void putU64(std::vector<unsigned char>& buffer, std::uint64_t value) {
+    for (int b = 0; b < 8; b++) {
+        buffer.push_back(static_cast<unsigned char>(value >> (8 * b)));
+    }
+}
+
+static std::uint32_t getU32(const unsigned char* p) {
+    std::uint32_t value = 0;
+    for (int b = 0; b < 4; b++) {
+        value |= static_cast<std::uint32_t>(p[b]) << (8 * b);
+    }
+    return value;
+}
+
+static std::uint64_t getU64(const unsigned char* p) {
+    std::uint64_t value = 0;
+    for (int b = 0; b < 8; b++) {
+        value |= static_cast<std::uint64_t>(p[b]) << (8 * b);
+    }
+    return value;
+}
+
+static const int HEADER_BYTES = 40;
+static const int TICK_BYTES = 9;
+
+// ============================================================
+// Recorder
+// ============================================================
+
+ReplayRecorder::ReplayRecorder(unsigned seed, const WorldConfig& config, long reserveTicks) {
+    replay.seed = seed;
+    replay.config = config;
+    replay.inputs.reserve(reserveTicks);
+    replay.hashes.reserve(reserveTicks);
+}
+
+void ReplayRecorder::record(const InputFrame& input, std::uint64_t stateHash) {
+    replay.inputs.push_back(packInput(input));
+    replay.hashes.push_back(stateHash);
+}
+
+long ReplayRecorder::getTickCount() const {
+    return static_cast<long>(replay.inputs.size());
+}
+
+/**
+ * Serialize into one buffer, then a single fwrite
+ */
+bool ReplayRecorder::save(const char* path) const {
+    std::vector<unsigned char> buffer;
+    buffer.reserve(HEADER_BYTES + replay.inputs.size() * TICK_BYTES);
+
+    buffer.push_back('A');
+    buffer.push_back('S');
+    buffer.push_back('T');
+    buffer.push_back('R');
+    putU32(buffer, REPLAY_VERSION);
+    putU32(buffer, replay.seed);
+    putU32(buffer, static_cast<std::uint32_t>(replay.inputs.size()));
+
+    const WorldConfig& config = replay.config;
+    std::uint32_t flags = 0;
+    if (config.shipInvulnerable) flags |= CONFIG_SHIP_INVULNERABLE;
+    if (config.continuousCollision) flags |= CONFIG_CONTINUOUS_COLLISION;
+    if (config.asteroidBounce) flags |= CONFIG_ASTEROID_BOUNCE;
+
+    putU32(buffer, static_cast<std::uint32_t>(config.asteroidCapacity));
+    putU32(buffer, static_cast<std::uint32_t>(config.photonCapacity));
+    putU32(buffer, static_cast<std::uint32_t>(config.startingAsteroids));
+    putU32(buffer, static_cast<std::uint32_t>(config.photonsPerFire));
+    putU32(buffer, static_cast<std::uint32_t>(config.asteroidSortInterval));
+    putU32(buffer, flags);
+
+    for (std::size_t t = 0; t < replay.inputs.size(); t++) {
+        buffer.push_back(replay.inputs[t]);
+        putU64(buffer, replay.hashes[t]);
+    }
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return false;
+
+    bool ok = std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    return std::fclose(file) == 0 && ok;
+}
+
+// ============================================================
+// Loading / replaying
+// ============================================================
+
+bool loadReplay(const char* path, Replay& out) {
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr)
+        return false;
+
+    std::vector<unsigned char> buffer;
+    unsigned char chunk[4096];
+    std::size_t n;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        buffer.insert(buffer.end(), chunk, chunk + n);
+    }
+    std::fclose(file);
+
+    if (buffer.size() < static_cast<std::size_t>(HEADER_BYTES))
+        return false;
+
+    const unsigned char* p = buffer.data();
+    if (p[0] != 'A' || p[1] != 'S' || p[2] != 'T' || p[3] != 'R')
+        return false;
+    if (getU32(p + 4) != REPLAY_VERSION)
+        return false;
+
+    std::uint32_t tickCount = getU32(p + 12);
+    if (buffer.size() != HEADER_BYTES + static_cast<std::size_t>(tickCount) * TICK_BYTES)
+        return false;
+
+    // Capacities a World can be built with, and no flags this build doesn't know
+    WorldConfig config;
+    config.asteroidCapacity = static_cast<std::int32_t>(getU32(p + 16));
+    config.photonCapacity = static_cast<std::int32_t>(getU32(p + 20));
+    config.startingAsteroids = static_cast<std::int32_t>(getU32(p + 24));
+    config.photonsPerFire = static_cast<std::int32_t>(getU32(p + 28));
+    config.asteroidSortInterval = static_cast<std::int32_t>(getU32(p + 32));
+    std::uint32_t flags = getU32(p + 36);
+
+    if (config.asteroidCapacity <= 0 || config.asteroidCapacity > ENTITY_MAX_SLOTS ||
+        config.photonCapacity <= 0 || config.photonCapacity > ENTITY_MAX_SLOTS ||
+        config.startingAsteroids < 0 || config.photonsPerFire < 0 || config.asteroidSortInterval < 0 ||
+        (flags & ~static_cast<std::uint32_t>(CONFIG_SHIP_INVULNERABLE | CONFIG_CONTINUOUS_COLLISION |
+                                             CONFIG_ASTEROID_BOUNCE)) != 0)
+        return false;
+
+    config.shipInvulnerable = (flags & CONFIG_SHIP_INVULNERABLE) != 0;
+    config.continuousCollision = (flags & CONFIG_CONTINUOUS_COLLISION) != 0;
+    config.asteroidBounce = (flags & CONFIG_ASTEROID_BOUNCE) != 0;
+
+    out.seed = getU32(p + 8);
+    out.config = config;
+    out.inputs.resize(tickCount);
+    out.hashes.resize(tickCount);
+
+    p += HEADER_BYTES;
+    for (std::uint32_t t = 0; t < tickCount; t++, p += TICK_BYTES) {
+        out.inputs[t] = p[0];
+        out.hashes[t] = getU64(p + 1);
+    }
+
+    return true;
+}
+
+ReplayResult runReplay(const Replay& replay, World& world) {
+    ReplayResult result;
+    long tickCount = static_cast<long>(replay.inputs.size());
+
+    for (long t = 0; t < tickCount; t++) {
+        world.step(unpackInput(replay.inputs[t]));
+        result.ticks++;
+        result.finalHash = world.stateHash();
+
+        if (result.finalHash != replay.hashes[t]) {
+            result.firstMismatch = t;
+            break;
+        }
+    }
+
+    return result;
+}
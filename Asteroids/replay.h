@@ -0,0 +1,141 @@
+/*
+*   File: replay.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Deterministic input recording and replay. A recording is the seed and the WorldConfig plus one byte of
+*   input bits and one state hash per tick, so a session can be re-run headlessly at full speed and checked tick by tick.
+*
+*/
+
+#ifndef REPLAY_H
+#define REPLAY_H
+#include "world.h"
+#include <cstdint>
+#include <vector>
+
+// File layout (little endian):
+//   header: "ASTR" | u32 version | u32 seed | u32 tick count
+//           | i32 asteroid capacity | i32 photon capacity | i32 starting asteroids | i32 photons per fire
+//           | i32 asteroid sort interval | u32 ReplayConfigBit flags
+//   body:   tick count x (u8 input bits | u64 state hash after the tick)
+// Version 2: spawns come from PCG32 streams instead of std::rand, so version 1 files no longer replay
+// Version 3: hits are tested against asteroid outlines instead of bounding circles
+// Version 4: photon expiry, invincibility and the explosion run on a timer wheel (removal order changed)
+// Version 5: stress mode sorts its asteroids by grid cell (claim order changed); normal games are unaffected
+// Version 6: --ccd sweeps against asteroid outlines instead of bounding circles
+// Version 7: the header carries the WorldConfig, so a replay runs with the settings it was recorded with
+const std::uint32_t REPLAY_VERSION = 7;
+
+// Default ticks reserved up front by a recorder (10 minutes at 60 fps)
+const long REPLAY_RESERVE_TICKS = 60 * 60 * 10;
+
+enum ReplayInputBit {
+    INPUT_ROTATE_LEFT = 1 << 0,
+    INPUT_ROTATE_RIGHT = 1 << 1,
+    INPUT_THRUST = 1 << 2,
+    INPUT_FIRE = 1 << 3,
+    INPUT_RESTART = 1 << 4
+};
+
+enum ReplayConfigBit {
+    CONFIG_SHIP_INVULNERABLE = 1 << 0,
+    CONFIG_CONTINUOUS_COLLISION = 1 << 1,
+    CONFIG_ASTEROID_BOUNCE = 1 << 2
+};
+
+/**
+ * Packs an InputFrame into the bits stored per tick.
+ *
+ * @param input Input to pack
+ * @return ReplayInputBit flags
+ */
+std::uint8_t packInput(const InputFrame& input);
+
+/**
+ * Unpacks stored bits back into an InputFrame.
+ *
+ * @param bits ReplayInputBit flags
+ * @return Input for that tick
+ */
+InputFrame unpackInput(std::uint8_t bits);
+
+/**
+ * A whole recording held in memory.
+ */
+struct Replay {
+    unsigned seed = 42;
+    WorldConfig config;
+    std::vector<std::uint8_t> inputs;
+    std::vector<std::uint64_t> hashes;
+};
+
+/**
+ * Result of re-running a recording.
+ */
+struct ReplayResult {
+    long ticks = 0;
+    long firstMismatch = -1;    // first tick whose hash differs, -1 if every tick matched
+    std::uint64_t finalHash = 0;
+};
+
+class ReplayRecorder {
+    private:
+
+    Replay replay;
+
+    public:
+
+    /**
+     * Starts an empty recording with room for reserveTicks ticks, so record() does not allocate until then.
+     *
+     * @param seed Seed the recorded World was created with
+     * @param config Config the recorded World runs with (World::getConfig(), after any load)
+     * @param reserveTicks Ticks to reserve up front
+    */
+    ReplayRecorder(unsigned seed, const WorldConfig& config, long reserveTicks = REPLAY_RESERVE_TICKS);
+
+    /**
+     * Appends one tick. Call right after World::step with the same input.
+     *
+     * @param input Input that was stepped
+     * @param stateHash World::stateHash() after the step
+    */
+    void record(const InputFrame& input, std::uint64_t stateHash);
+
+    /**
+     * @return Number of ticks recorded so far
+    */
+    long getTickCount() const;
+
+    /**
+     * Writes the recording to disk.
+     *
+     * @param path File to write
+     * @return True if the whole file was written
+    */
+    bool save(const char* path) const;
+
+};
+
+/**
+ * Reads a recording written by ReplayRecorder::save.
+ *
+ * @param path File to read
+ * @param out Filled with the recording
+ * @return False if the file is missing, truncated, not a replay, or records a config no World could run
+ */
+bool loadReplay(const char* path, Replay& out);
+
+/**
+ * Re-runs a recording on a fresh World and checks the state hash after every tick.
+ * Stops at the first mismatch.
+ *
+ * @param replay Recording to run
+ * @param world World to step (must be freshly created with replay.seed and replay.config)
+ * @return Ticks run, first mismatching tick and the final hash
+ */
+ReplayResult runReplay(const Replay& replay, World& world);
+
+#endif
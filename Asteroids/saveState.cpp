@@ -0,0 +1,156 @@
+/*
+*   File: saveState.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Flat binary save files: header checks, a single-write save and a memory mapped load (read into a
+*   buffer on Windows).
+*/
+
+#include "saveState.h"
+#include <cstdio>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ============================================================
+// Header checks
+// ============================================================
+
+/**
+ * A section is usable if it starts aligned and ends inside the block
+ */
+static bool sectionFits(std::uint64_t offset, std::uint64_t bytes, std::size_t size) {
+    return offset % SAVE_ALIGN == 0 && offset >= sizeof(SaveHeader) && offset <= size && bytes <= size - offset;
+}
+
+const SaveHeader* findSaveHeader(const unsigned char* data, std::size_t size) {
+    if (data == nullptr || size < sizeof(SaveHeader))
+        return nullptr;
+
+    const SaveHeader* header = reinterpret_cast<const SaveHeader*>(data);
+
+    if (header -> magic[0] != 'A' || header -> magic[1] != 'S' || header -> magic[2] != 'A' || header -> magic[3] != 'V')
+        return nullptr;
+    if (header -> version != SAVE_VERSION || header -> byteOrder != SAVE_BYTE_ORDER)
+        return nullptr;
+    if (header -> headerBytes != sizeof(SaveHeader) || header -> totalBytes != size)
+        return nullptr;
+    if (header -> asteroidCount < 0 || header -> photonCount < 0 || header -> photonCapacity < 0)
+        return nullptr;
+
+    if (!sectionFits(header -> asteroidOffset, 0, size) ||
+        !sectionFits(header -> photonOffset, 0, size) ||
+        !sectionFits(header -> photonTimerOffset, static_cast<std::uint64_t>(header -> photonCapacity) * sizeof(int), size) ||
+        !sectionFits(header -> timerOffset, header -> timerBytes, size))
+        return nullptr;
+
+    return header;
+}
+
+// ============================================================
+// Writing
+// ============================================================
+
+/**
+ * The block is already laid out, so this is one fwrite
+ */
+bool writeSaveFile(const char* path, const std::vector<unsigned char>& bytes) {
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return false;
+
+    bool ok = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    return std::fclose(file) == 0 && ok;
+}
+
+// ============================================================
+// Mapped reading
+// ============================================================
+
+MappedFile::MappedFile() {
+    bytes = nullptr;
+    length = 0;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifndef _WIN32
+
+bool MappedFile::open(const char* path) {
+    close();
+
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // The mapping keeps the file alive on its own, the descriptor isn't needed past this
+    void* mapped = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+        return false;
+
+    bytes = static_cast<const unsigned char*>(mapped);
+    length = static_cast<std::size_t>(info.st_size);
+    return true;
+}
+
+void MappedFile::close() {
+    if (bytes != nullptr) {
+        munmap(const_cast<unsigned char*>(bytes), length);
+    }
+    bytes = nullptr;
+    length = 0;
+}
+
+#else
+
+/**
+ * No mmap here: one fread of the whole file into a buffer
+ */
+bool MappedFile::open(const char* path) {
+    close();
+
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr)
+        return false;
+
+    std::fseek(file, 0, SEEK_END);
+    long end = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    if (end <= 0) {
+        std::fclose(file);
+        return false;
+    }
+
+    buffer.resize(static_cast<std::size_t>(end));
+    bool ok = std::fread(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    std::fclose(file);
+    if (!ok)
+        return false;
+
+    bytes = buffer.data();
+    length = buffer.size();
+    return true;
+}
+
+void MappedFile::close() {
+    buffer.clear();
+    bytes = nullptr;
+    length = 0;
+}
+
+#endif
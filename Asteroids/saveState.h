@@ -0,0 +1,162 @@
+/*
+*   File: saveState.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Flat binary save files for the whole World. A save is one block laid out exactly as it sits in memory
+*   (fixed header, then each array back to back), written with a single write and read back by mapping the file, so
+*   loading is a handful of bulk copies instead of parsing object by object.
+*
+*/
+
+#ifndef SAVESTATE_H
+#define SAVESTATE_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// File layout (native byte order, every section starts on an 8 byte boundary so it can be used straight from the
+// mapping):
+//   SaveHeader
+//   asteroids:     AsteroidStore::saveTo block (x, y, vx, vy, radius, age, shape; count entries each),
+//                  then its slot map (slot order and generation; capacity entries each)
+//   photons:       PhotonStore::saveTo block (x, y, vx, vy, radius, angle, age), then its slot map
+//   photon timers: photon capacity x i32, the wheel timer of the photon in each slot (-1 for none)
+//   timer wheel:   TimerWheel::saveTo block (clock, slot lists and the whole timer pool)
+// Files are only read back on the kind of machine that wrote them; byteOrder catches the obvious mismatch.
+const std::uint32_t SAVE_VERSION = 4;
+const std::uint32_t SAVE_BYTE_ORDER = 0x01020304;
+const std::size_t SAVE_ALIGN = 8;
+
+/**
+ * Fixed part of a save: the config, counters, ship, random streams, and where each array section starts.
+ */
+struct SaveHeader {
+    char magic[4];                  // "ASAV"
+    std::uint32_t version;
+    std::uint32_t byteOrder;        // SAVE_BYTE_ORDER as the writer saw it
+    std::uint32_t headerBytes;      // sizeof(SaveHeader)
+    std::uint64_t totalBytes;
+
+    // WorldConfig
+    std::int32_t asteroidCapacity;
+    std::int32_t photonCapacity;
+    std::int32_t startingAsteroids;
+    std::int32_t photonsPerFire;
+    std::uint8_t shipInvulnerable;
+    std::uint8_t continuousCollision;
+    std::uint8_t asteroidBounce;
+
+    // Counters
+    std::uint8_t gameOver;
+    std::int32_t score;
+    std::int32_t lives;
+    std::int32_t invincibilityTimer;
+    std::int64_t tick;
+    std::int64_t shipExplodedAt;
+
+    // Ship
+    double shipX;
+    double shipY;
+    double shipVelX;
+    double shipVelY;
+    double shipRadius;
+    double shipAngle;
+    std::int32_t shipType;
+    std::int32_t shipAge;
+    std::int32_t shipInvincible;
+
+    // Spawn, shape and split streams
+    std::int32_t rngPadding;
+    std::uint64_t rngState[3];
+    std::uint64_t rngIncrement[3];
+
+    // Sections
+    std::int32_t asteroidCount;
+    std::int32_t asteroidStoreCapacity;     // may have grown past asteroidCapacity
+    std::int32_t photonCount;
+    std::int32_t asteroidSortInterval;      // WorldConfig, here to keep the offsets aligned
+    std::uint64_t asteroidOffset;
+    std::uint64_t photonOffset;
+    std::uint64_t photonTimerOffset;
+    std::uint64_t timerOffset;
+    std::uint64_t timerBytes;
+};
+
+static_assert(sizeof(SaveHeader) % SAVE_ALIGN == 0, "save sections must start aligned");
+
+/**
+ * Rounds a section size up so the next section starts aligned.
+ *
+ * @param bytes Section size
+ * @return bytes rounded up to a multiple of SAVE_ALIGN
+ */
+inline std::size_t alignSave(std::size_t bytes) {
+    return (bytes + SAVE_ALIGN - 1) & ~(SAVE_ALIGN - 1);
+}
+
+/**
+ * Checks that a block looks like a save this build can read: magic, version, byte order, header size, total size,
+ * and every section offset aligned and inside the block.
+ *
+ * @param data Start of the block (8 byte aligned)
+ * @param size Bytes in the block
+ * @return The header, or nullptr if the block is not a usable save
+ */
+const SaveHeader* findSaveHeader(const unsigned char* data, std::size_t size);
+
+/**
+ * Writes a save block (from World::save) to disk with one write.
+ *
+ * @param path File to write
+ * @param bytes Whole save
+ * @return True if the whole file was written
+ */
+bool writeSaveFile(const char* path, const std::vector<unsigned char>& bytes);
+
+/**
+ * Read-only view of a whole file. Mapped with mmap where there is one, so opening a save costs no copy and the OS
+ * only pages in what gets read; elsewhere (Windows) the file is read into a buffer instead.
+ */
+class MappedFile {
+    private:
+
+    const unsigned char* bytes;
+    std::size_t length;
+
+#ifdef _WIN32
+    std::vector<unsigned char> buffer;
+#endif
+
+    public:
+
+    MappedFile();
+
+    /**
+     * Unmaps the file if one is open.
+    */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Maps a file, closing whatever was open before.
+     *
+     * @param path File to open
+     * @return False if it is missing, empty or could not be mapped
+    */
+    bool open(const char* path);
+
+    void close();
+
+    /**
+     * @return Start of the file (page aligned when mapped), nullptr if nothing is open
+    */
+    const unsigned char* data() const { return bytes; }
+
+    std::size_t size() const { return length; }
+
+};
+#endif
@@ -0,0 +1,210 @@
+/*
+*   File: shapeLibrary.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Precomputed asteroid outlines, shared by the simulation and the renderer.
+*/
+
+#include "shapeLibrary.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Integer hash -> [0, 1), so the outlines are the same every run and never touch std::rand
+ */
+static float hashToUnit(std::uint32_t n) {
+    n ^= n >> 16;
+    n *= 0x7feb352dU;
+    n ^= n >> 15;
+    n *= 0x846ca68bU;
+    n ^= n >> 16;
+    return static_cast<float>(n >> 8) / 16777216.f;
+}
+
+/**
+ * Monotonic stand-in for atan2 in [0, 4), one division instead of a trig call
+ */
+static double pseudoAngle(double x, double y) {
+    if (y >= 0) {
+        return x >= 0 ? y / (x + y) : 1 - x / (y - x);
+    }
+    return x < 0 ? 2 - y / (-x - y) : 3 + x / (x - y);
+}
+
+ShapeLibrary::ShapeLibrary() {
+    for (int k = 0; k < ASTEROID_POINTS; k++) {
+        double angleRad = (2 * 3.14159265358979 / ASTEROID_POINTS) * k;
+        rayPseudoAngle[k] = static_cast<float>(pseudoAngle(std::cos(angleRad), std::sin(angleRad)));
+    }
+    rayPseudoAngle[0] = 0;
+    rayPseudoAngle[ASTEROID_POINTS] = 4;
+
+    double wedgeSin = std::sin(2 * 3.14159265358979 / ASTEROID_POINTS);
+    wedgeSinSq = wedgeSin * wedgeSin;
+
+    for (int s = 0; s < ASTEROID_SHAPES; s++) {
+        for (int k = 0; k < ASTEROID_POINTS; k++) {
+
+            float angleDeg = (360.f / ASTEROID_POINTS) * k;
+            float angleRad = angleDeg * 3.14159265f / 180.f;
+
+            int n = s * ASTEROID_POINTS + k;
+            float variation = 0.8f + hashToUnit(static_cast<std::uint32_t>(n)) * 0.4f;
+
+            pointX[n] = std::cos(angleRad) * variation;
+            pointY[n] = std::sin(angleRad) * variation;
+        }
+
+        const float* px = getX(s);
+        const float* py = getY(s);
+        outerRadius[s] = 0;
+        innerRadius[s] = 2;
+
+        for (int k = 0; k < ASTEROID_POINTS; k++) {
+            int next = (k + 1) % ASTEROID_POINTS;
+
+            // Distance to the edge's line, never more than to the edge itself, so the inscribed circle stays inside
+            int n = s * ASTEROID_POINTS + k;
+            float ex = px[next] - px[k];
+            float ey = py[next] - py[k];
+            edgeX[n] = ex;
+            edgeY[n] = ey;
+            edgeInvLengthSq[n] = 1.f / (ex * ex + ey * ey);
+
+            float edgeDist = std::fabs(px[k] * ey - py[k] * ex) / std::sqrt(ex * ex + ey * ey);
+
+            outerRadius[s] = std::max(outerRadius[s], std::sqrt(px[k] * px[k] + py[k] * py[k]));
+            innerRadius[s] = std::min(innerRadius[s], edgeDist);
+        }
+    }
+}
+
+/**
+ * Outlines are star shaped around the center: the wedge between two neighbouring points holds exactly one edge.
+ * Inside means inside the wedge's triangle, otherwise the circle has to reach one of the edges.
+ */
+bool ShapeLibrary::touchesCircle(int shape, double x, double y, double r) const {
+    double distSq = x * x + y * y;
+
+    double reach = outerRadius[shape] + r;
+    if (distSq > reach * reach)
+        return false;
+
+    double inner = innerRadius[shape] + r;
+    if (distSq <= inner * inner)
+        return true;
+
+    const float* px = getX(shape);
+    const float* py = getY(shape);
+    const float* ex = &edgeX[shape * ASTEROID_POINTS];
+    const float* ey = &edgeY[shape * ASTEROID_POINTS];
+    const float* invLengthSq = &edgeInvLengthSq[shape * ASTEROID_POINTS];
+    double rSq = r * r;
+
+    // Which wedge the center is in: estimate from the pseudo-angle, then step onto the right one
+    double angle = pseudoAngle(x, y);
+    int wedge = static_cast<int>(angle * (ASTEROID_POINTS / 4.0));
+    if (wedge >= ASTEROID_POINTS) wedge = ASTEROID_POINTS - 1;
+    while (wedge > 0 && angle < rayPseudoAngle[wedge]) wedge--;
+    while (wedge < ASTEROID_POINTS - 1 && angle >= rayPseudoAngle[wedge + 1]) wedge++;
+
+    // Inner side of the wedge's edge = inside the outline
+    if (ex[wedge] * (y - py[wedge]) - ey[wedge] * (x - px[wedge]) >= 0)
+        return true;
+
+    // Outside: touching means reaching an edge. A circle narrower than one wedge (as seen from the center) can
+    // only reach its own wedge's edge and the two beside it.
+    int first = 0;
+    int count = ASTEROID_POINTS;
+    if (rSq <= distSq * wedgeSinSq) {
+        first = wedge + ASTEROID_POINTS - 1;
+        count = 3;
+    }
+
+    for (int i = 0; i < count; i++) {
+        int k = (first + i) % ASTEROID_POINTS;
+        double rx = x - px[k];
+        double ry = y - py[k];
+
+        // Closest point on the edge
+        double t = (rx * ex[k] + ry * ey[k]) * invLengthSq[k];
+        t = t < 0 ? 0 : (t > 1 ? 1 : t);
+        double dx = rx - t * ex[k];
+        double dy = ry - t * ey[k];
+
+        if (dx * dx + dy * dy <= rSq)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * The earliest of: reaching r from an edge's line while level with the edge, or reaching r from one of the points.
+ * A circle already within r of a line when it comes level with that edge is within r of the edge's end point
+ * too, so that case is the point's.
+ */
+bool ShapeLibrary::sweepCircle(int shape, double x, double y, double dx, double dy, double r, double& toi) const {
+    if (touchesCircle(shape, x, y, r)) {
+        toi = 0;
+        return true;
+    }
+
+    double moveSq = dx * dx + dy * dy;
+    if (moveSq == 0)
+        return false;
+
+    const float* px = getX(shape);
+    const float* py = getY(shape);
+    const float* ex = &edgeX[shape * ASTEROID_POINTS];
+    const float* ey = &edgeY[shape * ASTEROID_POINTS];
+    const float* invLengthSq = &edgeInvLengthSq[shape * ASTEROID_POINTS];
+    double rSq = r * r;
+    double first = 2;
+
+    for (int k = 0; k < ASTEROID_POINTS; k++) {
+        double rx = x - px[k];
+        double ry = y - py[k];
+
+        // Point k: |(rx, ry) + t * (dx, dy)| = r, coming closer
+        double b = rx * dx + ry * dy;
+        double disc = b * b - moveSq * (rx * rx + ry * ry - rSq);
+        if (b < 0 && disc >= 0) {
+            first = std::min(first, (-b - std::sqrt(disc)) / moveSq);
+        }
+
+        // Edge k's line, on whichever side the circle comes from: cross / length = +-r
+        double cross = ex[k] * ry - ey[k] * rx;
+        double crossRate = ex[k] * dy - ey[k] * dx;
+        double reach = r * std::sqrt(ex[k] * ex[k] + ey[k] * ey[k]);
+        double t;
+
+        if (cross > reach && crossRate < 0) {
+            t = (cross - reach) / -crossRate;
+        } else if (cross < -reach && crossRate > 0) {
+            t = (-reach - cross) / crossRate;
+        } else {
+            continue;
+        }
+
+        // Level with the edge at that moment
+        double along = ((rx + t * dx) * ex[k] + (ry + t * dy) * ey[k]) * invLengthSq[k];
+        if (along >= 0 && along <= 1) {
+            first = std::min(first, t);
+        }
+    }
+
+    if (first > 1)
+        return false;
+
+    toi = first;
+    return true;
+}
+
+const ShapeLibrary& getShapeLibrary() {
+    static const ShapeLibrary library;
+    return library;
+}
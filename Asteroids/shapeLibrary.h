@@ -0,0 +1,101 @@
+/*
+*   File: shapeLibrary.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Precomputed asteroid outlines. ASTEROID_SHAPES jagged unit-radius outlines are built once and kept
+*   in one contiguous buffer, so an asteroid only stores a shape index and uses its radius as the scale. Also the
+*   exact circle-vs-outline test collision uses once the bounding circle check passes.
+*
+*/
+
+#ifndef SHAPELIBRARY_H
+#define SHAPELIBRARY_H
+#include "constants.h"
+
+class ShapeLibrary {
+    private:
+
+    // Shape s owns points [s * ASTEROID_POINTS, (s + 1) * ASTEROID_POINTS)
+    float pointX[ASTEROID_SHAPES * ASTEROID_POINTS];
+    float pointY[ASTEROID_SHAPES * ASTEROID_POINTS];
+
+    // Edge k runs from point k to point k + 1 (wrapping), with its 1 / length^2 for the closest point projection
+    float edgeX[ASTEROID_SHAPES * ASTEROID_POINTS];
+    float edgeY[ASTEROID_SHAPES * ASTEROID_POINTS];
+    float edgeInvLengthSq[ASTEROID_SHAPES * ASTEROID_POINTS];
+
+    // Every shape's point k sits on the same ray; its pseudo-angle (see touchesCircle) bounds wedge k
+    float rayPseudoAngle[ASTEROID_POINTS + 1];
+    double wedgeSinSq;
+
+    // Per shape: farthest point (bounding circle) and closest edge (inscribed circle), unit radius
+    float outerRadius[ASTEROID_SHAPES];
+    float innerRadius[ASTEROID_SHAPES];
+
+    public:
+
+    /**
+     * Builds every outline. Point k of each shape sits at angle k * 360 / ASTEROID_POINTS with a radius
+     * in [0.8, 1.2], the same jaggedness SpaceObject::generateAsteroidShape gives.
+    */
+    ShapeLibrary();
+
+    /**
+     * @param shape Shape index in [0, ASTEROID_SHAPES)
+     * @return ASTEROID_POINTS unit-radius x coordinates
+    */
+    const float* getX(int shape) const { return &pointX[shape * ASTEROID_POINTS]; }
+
+    /**
+     * @param shape Shape index in [0, ASTEROID_SHAPES)
+     * @return ASTEROID_POINTS unit-radius y coordinates
+    */
+    const float* getY(int shape) const { return &pointY[shape * ASTEROID_POINTS]; }
+
+    /**
+     * @param shape Shape index in [0, ASTEROID_SHAPES)
+     * @return Distance from the center to the farthest point, at unit radius
+    */
+    float getOuterRadius(int shape) const { return outerRadius[shape]; }
+
+    /**
+     * Exact test of a circle against one outline. Coordinates are in the outline's unit space (relative to the
+     * asteroid's center, divided by its radius), so nothing has to be transformed per vertex.
+     * Circles that clear the bounding circle or reach the inscribed circle are decided without the edge loop.
+     *
+     * @param shape Shape index in [0, ASTEROID_SHAPES)
+     * @param x Circle center x, unit space
+     * @param y Circle center y, unit space
+     * @param r Circle radius, unit space
+     * @return true if the circle overlaps the outline or anything inside it
+    */
+    bool touchesCircle(int shape, double x, double y, double r) const;
+
+    /**
+     * Moving version of touchesCircle: the circle slides in a straight line from (x, y) to (x + dx, y + dy), in
+     * the outline's unit space, and this finds the first moment it touches. Starting outside, that is when it
+     * first comes within r of an edge or a point, so each edge and point is solved for directly.
+     *
+     * @param shape Shape index in [0, ASTEROID_SHAPES)
+     * @param x Circle center x at the start, unit space
+     * @param y Circle center y at the start, unit space
+     * @param dx Distance moved along x, unit space
+     * @param dy Distance moved along y, unit space
+     * @param r Circle radius, unit space
+     * @param toi Set on a hit: fraction of the move (0 to 1) when it first touched
+     * @return true if the circle touches the outline or anything inside it at any point of the move
+    */
+    bool sweepCircle(int shape, double x, double y, double dx, double dy, double r, double& toi) const;
+
+};
+
+/**
+ * Gets the shared shape library, built the first time it is asked for.
+ *
+ * @return The one ShapeLibrary for the program
+ */
+const ShapeLibrary& getShapeLibrary();
+
+#endif
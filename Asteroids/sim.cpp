@@ -0,0 +1,363 @@
+/*
+*   File: sim.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Headless driver for the Asteroids simulation. Runs the World as fast as the CPU allows with a scripted
+*   pilot (no window, no frame limit) and reports ticks per second, for load and soak testing. Can also record the
+*   pilot's session, or replay a recording and verify it tick by tick. --stress N starts with N asteroids and fires a
+*   torpedo fan every tick to load update, collision and growth at scale. --batch N steps N games in lockstep on a
+*   thread pool and reports aggregate environment steps per second. Otherwise --threads T splits a single world's photon
+*   collisions over T threads (results are identical to the serial pass). --save FILE checkpoints the world at the end
+*   of the run and --load FILE starts from a checkpoint instead of a new game (with --batch, every environment forks
+*   from it).
+*
+*/
+
+#include "world.h"
+#include "allocCounter.h"
+#include "profiler.h"
+#include "replay.h"
+#include "batchEnv.h"
+#include "threadPool.h"
+#include "saveState.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+/**
+ * Scripted pilot: spins, thrusts in bursts, fires every fireEvery ticks and restarts on game over.
+ *
+ * @param tick Current tick number
+ * @param gameOver Whether the world is waiting on a restart
+ * @param fireEvery Ticks between shots (1 = rapid fire)
+ * @return Input for this tick
+ */
+InputFrame scriptedInput(long tick, bool gameOver, int fireEvery) {
+    InputFrame input;
+    input.rotateRight = true;
+    input.thrust = (tick % 90) < 30;
+    input.fire = (tick % fireEvery) == 0;
+    input.restart = gameOver;
+    return input;
+}
+
+/**
+ * Maps a save file and restores it into a World, reporting how long the load took.
+ *
+ * @param path Save written with --save (or F5 in the game)
+ * @param world World to restore into
+ * @return False if the file is missing or not a readable save
+ */
+bool loadWorldFile(const char* path, World& world) {
+    MappedFile file;
+    if (!file.open(path)) {
+        std::cout << "Could not read save " << path << "\n";
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    bool ok = world.load(file.data(), file.size());
+    auto end = std::chrono::steady_clock::now();
+
+    if (!ok) {
+        std::cout << path << " is not a save this build can read\n";
+        return false;
+    }
+
+    std::cout << "Loaded:       " << path << " at tick " << world.getTick() << " (" << file.size() << " bytes in "
+              << std::chrono::duration<double, std::micro>(end - start).count() << " us)\n";
+    return true;
+}
+
+/**
+ * Whether two configs play the same game.
+ *
+ * @param a First config
+ * @param b Second config
+ * @return True if every setting matches
+ */
+bool sameConfig(const WorldConfig& a, const WorldConfig& b) {
+    return a.asteroidCapacity == b.asteroidCapacity && a.photonCapacity == b.photonCapacity &&
+           a.startingAsteroids == b.startingAsteroids && a.photonsPerFire == b.photonsPerFire &&
+           a.shipInvulnerable == b.shipInvulnerable && a.continuousCollision == b.continuousCollision &&
+           a.asteroidSortInterval == b.asteroidSortInterval && a.asteroidBounce == b.asteroidBounce;
+}
+
+/**
+ * Replays a recording headlessly as fast as possible and checks the state hash after every tick.
+ * The World runs with the config stored in the recording.
+ *
+ * @param path Recording made with --record (by the game or the sim)
+ * @param given Config from --stress, --ccd and --bounce, which has to match the recorded one, or nullptr if none
+ *              of them were passed
+ * @param threads Threads for the photon collision pass (1 = serial)
+ * @param loadPath Save the recording started from (recorded with --load), or nullptr for a new game
+ * @return Exit code: 0 if every tick matched, 1 otherwise
+ */
+int runReplayFile(const char* path, const WorldConfig* given, int threads, const char* loadPath) {
+    Replay replay;
+    if (!loadReplay(path, replay)) {
+        std::cout << "Could not read replay " << path << "\n";
+        return 1;
+    }
+
+    const WorldConfig& recorded = replay.config;
+    if (given != nullptr && !sameConfig(*given, recorded)) {
+        std::cout << path << " was recorded with other --stress, --ccd or --bounce settings;"
+                  << " leave them off to replay with the recorded ones\n";
+        return 1;
+    }
+
+    World world(replay.seed, recorded);
+    if (loadPath != nullptr && !loadWorldFile(loadPath, world))
+        return 1;
+
+    ThreadPool pool(threads);
+    world.setThreadPool(&pool);
+
+    auto start = std::chrono::steady_clock::now();
+    ReplayResult result = runReplay(replay, world);
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << "Replay:       " << path << " (seed " << replay.seed << ")\n";
+    std::cout << "Ticks:        " << result.ticks << " of " << replay.inputs.size() << "\n";
+    std::cout << "Final score:  " << world.getScore() << "\n";
+    std::cout << "Ticks/sec:    " << (seconds > 0 ? result.ticks / seconds : 0.0) << "\n";
+
+    if (result.firstMismatch >= 0) {
+        std::cout << "MISMATCH at tick " << result.firstMismatch + 1 << "\n";
+        return 1;
+    }
+
+    std::cout << "Verified:     every tick matches\n";
+    return 0;
+}
+
+/**
+ * Steps a BatchEnv of independent games with random actions and reports aggregate environment steps per second.
+ *
+ * @param envs Number of environments
+ * @param threads Threads to step on (0 = one per hardware thread)
+ * @param steps Lockstep steps to run
+ * @param seed Seed of environment 0 (and of the random policy)
+ * @param config Settings for every World
+ * @param loadPath Save every environment forks from, or nullptr for new games
+ * @return Exit code
+ */
+int runBatch(int envs, int threads, long steps, unsigned seed, const WorldConfig& config, const char* loadPath) {
+    ThreadPool pool(threads);
+    BatchEnv batch(envs, seed, pool, config);
+
+    if (loadPath != nullptr) {
+        MappedFile file;
+        auto forkStart = std::chrono::steady_clock::now();
+
+        if (!file.open(loadPath) || !batch.fork(file.data(), file.size())) {
+            std::cout << "Could not fork from " << loadPath << "\n";
+            return 1;
+        }
+
+        auto forkEnd = std::chrono::steady_clock::now();
+        std::cout << "Forked:       " << envs << " environments from " << loadPath << " in "
+                  << std::chrono::duration<double, std::milli>(forkEnd - forkStart).count() << " ms\n";
+    }
+
+    std::vector<std::uint8_t> actions(envs);
+    Pcg32 policy(seed, 0);
+
+    long episodes = 0;
+    double totalReward = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (long t = 0; t < steps; t++) {
+        // Random held keys, fire about one tick in four, never restart (done environments restart themselves)
+        for (int i = 0; i < envs; i++) {
+            std::uint8_t bits = static_cast<std::uint8_t>(policy.nextBelow(8));
+            if (policy.nextBelow(4) == 0) bits |= INPUT_FIRE;
+            actions[i] = bits;
+        }
+
+        batch.step(actions.data());
+
+        for (int i = 0; i < envs; i++) {
+            episodes += batch.getDones()[i];
+            totalReward += batch.getRewards()[i];
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double envSteps = static_cast<double>(envs) * steps;
+
+    std::cout << "Environments: " << envs << " on " << pool.getThreadCount() << " threads\n";
+    std::cout << "Steps:        " << steps << " (" << envSteps << " env steps)\n";
+    std::cout << "Episodes:     " << episodes << " finished, " << totalReward << " total reward\n";
+    std::cout << "Elapsed:      " << seconds << " s\n";
+    std::cout << "Env steps/s:  " << (seconds > 0 ? envSteps / seconds : 0.0) << "\n";
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    long ticks = 100000;
+    unsigned seed = 42;
+    bool profile = false;
+    const char* tracePath = nullptr;
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    int stressAsteroids = 0;
+    bool continuous = false;
+    bool bounce = false;
+    int batchEnvs = 0;
+    int threads = 0;
+    bool threadsGiven = false;
+    const char* savePath = nullptr;
+    const char* loadPath = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            ticks = std::atol(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = static_cast<unsigned>(std::atol(argv[++i]));
+        } else if (std::strcmp(argv[i], "--profile") == 0) {
+            profile = true;
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            profile = true;
+            tracePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--stress") == 0 && i + 1 < argc) {
+            stressAsteroids = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--ccd") == 0) {
+            continuous = true;
+        } else if (std::strcmp(argv[i], "--bounce") == 0) {
+            bounce = true;
+        } else if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            batchEnvs = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = std::atoi(argv[++i]);
+            threadsGiven = true;
+        } else if (std::strcmp(argv[i], "--save") == 0 && i + 1 < argc) {
+            savePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--load") == 0 && i + 1 < argc) {
+            loadPath = argv[++i];
+        } else {
+            std::cout << "Usage: " << argv[0] << " [--ticks N] [--seed S] [--profile] [--trace FILE]"
+                      << " [--record FILE] [--replay FILE] [--stress ASTEROIDS] [--ccd] [--bounce] [--batch ENVS] [--threads T]"
+                      << " [--save FILE] [--load FILE]\n";
+            return 1;
+        }
+    }
+
+    // Stress mode: thousands of asteroids, a 16-way torpedo fan every tick, ship can't die
+    WorldConfig config = stressAsteroids > 0 ? makeStressConfig(stressAsteroids) : WorldConfig();
+    config.continuousCollision = continuous;
+    config.asteroidBounce = bounce;
+    int fireEvery = stressAsteroids > 0 ? 1 : 10;
+
+    if (replayPath != nullptr) {
+        bool configGiven = stressAsteroids > 0 || continuous || bounce;
+        return runReplayFile(replayPath, configGiven ? &config : nullptr, threadsGiven ? threads : 1, loadPath);
+    }
+
+    if (batchEnvs > 0) {
+        return runBatch(batchEnvs, threads, ticks, seed, config, loadPath);
+    }
+
+    // A single world stays serial unless --threads is given
+    World world(seed, config);
+    if (loadPath != nullptr && !loadWorldFile(loadPath, world))
+        return 1;
+
+    ThreadPool pool(threadsGiven ? threads : 1);
+    world.setThreadPool(&pool);
+
+    int games = 1;
+    int peakAsteroids = 0;
+
+    ReplayRecorder recorder(seed, world.getConfig(), recordPath != nullptr ? ticks : 0);
+
+    Profiler profiler;
+    if (profile) {
+        world.setProfiler(&profiler);
+    }
+
+    // Everything the World needs is allocated by now, the loop itself should not allocate
+    long allocsBefore = getAllocationCount();
+    auto start = std::chrono::steady_clock::now();
+
+    for (long t = 0; t < ticks; t++) {
+        bool restarting = world.isGameOver();
+
+        InputFrame input = scriptedInput(world.getTick(), restarting, fireEvery);
+
+        if (profile) profiler.beginFrame();
+        world.step(input);
+        if (profile) profiler.endFrame();
+
+        if (recordPath != nullptr) {
+            recorder.record(input, world.stateHash());
+        }
+
+        if (restarting) games++;
+        peakAsteroids = std::max(peakAsteroids, world.getAsteroids().size());
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    long loopAllocs = getAllocationCount() - allocsBefore;
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << "Ticks:        " << ticks << "\n";
+    std::cout << "Games played: " << games << "\n";
+    std::cout << "Final score:  " << world.getScore() << "\n";
+    std::cout << "Asteroids:    " << world.getAsteroids().size() << " at the end, " << peakAsteroids << " peak\n";
+    std::cout << "Elapsed:      " << seconds << " s\n";
+    std::cout << "Ticks/sec:    " << (seconds > 0 ? ticks / seconds : 0.0) << "\n";
+    std::cout << "Heap allocs:  " << loopAllocs << " during the loop\n";
+    std::cout << "Threads:      " << pool.getThreadCount() << "\n";
+
+    if (profile) {
+        FrameStats stats = profiler.getFrameStats();
+        std::cout << "Tick time (last " << PROFILE_HISTORY << "): min " << stats.minMs * 1000.0
+                  << " us, avg " << stats.avgMs * 1000.0 << " us, p99 " << stats.p99Ms * 1000.0 << " us\n";
+
+        for (int p = PHASE_CONTROLS; p <= PHASE_COLLISIONS; p++) {
+            ProfilePhase phase = static_cast<ProfilePhase>(p);
+            std::cout << "  " << Profiler::getPhaseName(phase) << ": "
+                      << profiler.getPhaseAverageMs(phase) * 1000.0 << " us\n";
+        }
+    }
+
+    if (tracePath != nullptr && profiler.writeChromeTrace(tracePath)) {
+        std::cout << "Trace saved to " << tracePath << "\n";
+    }
+
+    if (savePath != nullptr) {
+        std::vector<unsigned char> state;
+        world.save(state);
+
+        if (!writeSaveFile(savePath, state)) {
+            std::cout << "Could not write " << savePath << "\n";
+            return 1;
+        }
+        std::cout << "Saved tick " << world.getTick() << " to " << savePath << " (" << state.size() << " bytes)\n";
+    }
+
+    if (recordPath != nullptr) {
+        if (!recorder.save(recordPath)) {
+            std::cout << "Could not write " << recordPath << "\n";
+            return 1;
+        }
+        std::cout << "Recorded " << recorder.getTickCount() << " ticks to " << recordPath << "\n";
+    }
+
+    return 0;
+}
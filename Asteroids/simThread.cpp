@@ -0,0 +1,200 @@
+/*
+*   File: simThread.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Fixed timestep simulation thread. Steps the World, records and profiles each tick, and publishes a
+*   Snapshot through the triple buffer. Quick saves and loads are handled between ticks.
+*/
+
+#include "simThread.h"
+#include "timing.h"
+#include "saveState.h"
+#include <chrono>
+#include <iostream>
+
+SimThread::SimThread(World& world, ReplayRecorder* recorder, const std::string& tracePath, const std::string& savePath)
+    : world(world), recorder(recorder), profiler(SIM_TRACE_THREAD), running(false),
+      rotateLeft(false), rotateRight(false), thrust(false),
+      firePressed(false), restartPressed(false), traceRequested(false), tracePath(tracePath),
+      saveRequested(false), loadRequested(false), savePath(savePath) {
+    lastShipAngle = world.getShip().angle;
+    publish(std::chrono::steady_clock::now());
+}
+
+SimThread::~SimThread() {
+    stop();
+}
+
+void SimThread::start() {
+    if (running.exchange(true))
+        return;
+
+    world.setProfiler(&profiler);
+    thread = std::thread(&SimThread::run, this);
+}
+
+void SimThread::stop() {
+    running = false;
+
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+// ============================================================
+// Render thread side
+// ============================================================
+
+void SimThread::setHeldKeys(bool left, bool right, bool thrusting) {
+    rotateLeft.store(left, std::memory_order_relaxed);
+    rotateRight.store(right, std::memory_order_relaxed);
+    thrust.store(thrusting, std::memory_order_relaxed);
+}
+
+void SimThread::pressFire() {
+    firePressed = true;
+}
+
+void SimThread::pressRestart() {
+    restartPressed = true;
+}
+
+void SimThread::requestTrace() {
+    traceRequested = true;
+}
+
+void SimThread::requestSave() {
+    saveRequested = true;
+}
+
+void SimThread::requestLoad() {
+    loadRequested = true;
+}
+
+const Snapshot& SimThread::latestSnapshot() {
+    snapshots.update();
+    return snapshots.getFront();
+}
+
+const Profiler& SimThread::getProfiler() const {
+    return profiler;
+}
+
+// ============================================================
+// Sim thread side
+// ============================================================
+
+/**
+ * Presses are consumed, held keys are just read
+ */
+InputFrame SimThread::takeInput() {
+    InputFrame input;
+    input.rotateLeft = rotateLeft.load(std::memory_order_relaxed);
+    input.rotateRight = rotateRight.load(std::memory_order_relaxed);
+    input.thrust = thrust.load(std::memory_order_relaxed);
+    input.fire = firePressed.exchange(false);
+    input.restart = restartPressed.exchange(false);
+    return input;
+}
+
+/**
+ * Fill the back slot and swap it to the reader
+ */
+void SimThread::publish(std::chrono::steady_clock::time_point tickTime) {
+    Snapshot& snapshot = snapshots.getBack();
+    world.capture(snapshot);
+
+    snapshot.shipPrevAngle = lastShipAngle;
+    lastShipAngle = snapshot.shipAngle;
+
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        snapshot.simPhaseMs[p] = profiler.getPhaseAverageMs(static_cast<ProfilePhase>(p));
+    }
+    snapshot.simTickStats = profiler.getFrameStats();
+    snapshot.publishedAt = tickTime;
+
+    snapshots.publish();
+}
+
+void SimThread::quickSave() {
+    world.save(saveBuffer);
+
+    if (writeSaveFile(savePath.c_str(), saveBuffer)) {
+        std::cout << "Saved tick " << world.getTick() << " to " << savePath << "\n";
+    } else {
+        std::cout << "Could not write " << savePath << "\n";
+    }
+}
+
+/**
+ * Maps the quick save and swaps it in; the caller publishes straight away so the next frame shows it
+ */
+bool SimThread::quickLoad() {
+    if (recorder != nullptr) {
+        std::cout << "Quick load is off while recording\n";
+        return false;
+    }
+
+    MappedFile file;
+    if (!file.open(savePath.c_str()) || !world.load(file.data(), file.size())) {
+        std::cout << "Could not load " << savePath << "\n";
+        return false;
+    }
+
+    // No rotation to interpolate across the jump
+    lastShipAngle = world.getShip().angle;
+    std::cout << "Loaded tick " << world.getTick() << " from " << savePath << "\n";
+    return true;
+}
+
+/**
+ * Wakes at TICK_RATE through a FramePacer and runs however many ticks the FixedStep accumulator says are due, so an
+ * oversleep is made up on the next wake instead of slowing the game down. Long stalls (debugger, sleep) are dropped
+ * after MAX_CATCHUP_TICKS.
+ */
+void SimThread::run() {
+    typedef std::chrono::steady_clock Clock;
+
+    FixedStep stepper(1.0 / TICK_RATE, MAX_CATCHUP_TICKS);
+    FramePacer pacer(TICK_RATE);
+    Clock::time_point last = Clock::now();
+
+    while (running.load(std::memory_order_relaxed)) {
+        Clock::time_point now = Clock::now();
+        int ticks = stepper.advance(std::chrono::duration<double>(now - last).count());
+        last = now;
+
+        for (int t = 0; t < ticks; t++) {
+            InputFrame input = takeInput();
+
+            profiler.beginFrame();
+            world.step(input);
+            profiler.endFrame();
+
+            if (recorder != nullptr) {
+                recorder -> record(input, world.stateHash());
+            }
+        }
+
+        if (ticks > 0) {
+            publish(now - std::chrono::duration_cast<Clock::duration>(
+                              std::chrono::duration<double>(stepper.getLeftoverSeconds())));
+        }
+
+        if (traceRequested.exchange(false)) {
+            profiler.writeChromeTrace(tracePath);
+        }
+
+        if (saveRequested.exchange(false)) {
+            quickSave();
+        }
+
+        if (loadRequested.exchange(false) && quickLoad()) {
+            publish(now);
+        }
+
+        pacer.wait();
+    }
+}
@@ -0,0 +1,135 @@
+/*
+*   File: simThread.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Runs the World on its own thread at a fixed TICK_RATE. Input comes in through atomics written by the
+*   render thread, and every tick is published as a Snapshot through a lock-free triple buffer, so a slow frame or a
+*   vsync stall on the render thread never delays the simulation. Quick save and quick load also run here, between
+*   ticks, so the World is never read or replaced mid-step.
+*
+*/
+
+#ifndef SIMTHREAD_H
+#define SIMTHREAD_H
+#include "world.h"
+#include "snapshot.h"
+#include "tripleBuffer.h"
+#include "replay.h"
+#include "profiler.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Trace row used by the sim thread's profiler (the render thread uses row 1)
+const int SIM_TRACE_THREAD = 3;
+
+class SimThread {
+    private:
+
+    World& world;
+    ReplayRecorder* recorder;
+
+    Profiler profiler;
+    TripleBuffer<Snapshot> snapshots;
+
+    std::thread thread;
+    std::atomic<bool> running;
+
+    // Held keys, rewritten by the render thread every frame
+    std::atomic<bool> rotateLeft;
+    std::atomic<bool> rotateRight;
+    std::atomic<bool> thrust;
+
+    // Key presses waiting for the next tick
+    std::atomic<bool> firePressed;
+    std::atomic<bool> restartPressed;
+
+    std::atomic<bool> traceRequested;
+    std::string tracePath;
+
+    std::atomic<bool> saveRequested;
+    std::atomic<bool> loadRequested;
+    std::string savePath;
+    std::vector<unsigned char> saveBuffer;     // reused by every quick save
+
+    double lastShipAngle;
+
+    InputFrame takeInput();
+    void publish(std::chrono::steady_clock::time_point tickTime);
+    void quickSave();
+    bool quickLoad();
+    void run();
+
+    public:
+
+    /**
+     * Publishes the World's current state as the first snapshot. The thread does not run until start().
+     *
+     * @param world World to step (only touched by the sim thread while it runs)
+     * @param recorder Records every tick if not nullptr (only touched by the sim thread while it runs)
+     * @param tracePath Where requestTrace() saves the sim thread's Chrome trace
+     * @param savePath Where requestSave() writes and requestLoad() reads the quick save
+    */
+    SimThread(World& world, ReplayRecorder* recorder, const std::string& tracePath, const std::string& savePath);
+
+    /**
+     * Stops and joins the thread if it is still running.
+    */
+    ~SimThread();
+
+    SimThread(const SimThread&) = delete;
+    SimThread& operator=(const SimThread&) = delete;
+
+    void start();
+
+    /**
+     * Stops the thread after its current tick and waits for it. The World and Profiler are safe to read afterwards.
+    */
+    void stop();
+
+    // ===================== Render thread side ===============================================
+
+    /**
+     * @param left Rotate left held
+     * @param right Rotate right held
+     * @param thrusting Thrust held
+    */
+    void setHeldKeys(bool left, bool right, bool thrusting);
+
+    void pressFire();
+    void pressRestart();
+
+    /**
+     * Asks the sim thread to save its own Chrome trace to tracePath after its next tick.
+    */
+    void requestTrace();
+
+    /**
+     * Asks the sim thread to save the World to savePath after its current tick.
+    */
+    void requestSave();
+
+    /**
+     * Asks the sim thread to load savePath after its current tick. Ignored while recording, since a recording can
+     * only replay from the state it started in.
+    */
+    void requestLoad();
+
+    /**
+     * Picks up the newest published tick, if any.
+     *
+     * @return Newest snapshot, valid until the next call
+    */
+    const Snapshot& latestSnapshot();
+
+    /**
+     * @return The sim thread's profiler, only safe to use after stop()
+    */
+    const Profiler& getProfiler() const;
+
+};
+#endif
@@ -0,0 +1,128 @@
+/*
+*   File: snapshot.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Read-only copy of everything the renderer needs from one simulation tick. The sim thread fills one,
+*   publishes it through a TripleBuffer, and the render thread draws it without ever touching the World.
+*
+*/
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+#include "constants.h"
+#include "spaceObject.h"
+#include "profiler.h"
+#include <chrono>
+#include <vector>
+
+// ===================== Effects ============================================================
+
+// Most recent effects a snapshot carries. The renderer only misses some if more than this many happen between two
+// frames, and then it is the oldest ones that go.
+const int EFFECT_HISTORY = 256;
+
+enum EffectKind {
+    EFFECT_ASTEROID_BREAK,
+    EFFECT_SHIP_EXPLODE
+};
+
+/**
+ * Something the renderer may want to show but the simulation doesn't keep (debris, sparks).
+ * Effect number n is stored at index n % EFFECT_HISTORY.
+ */
+struct Effect {
+    int kind;
+    float x;
+    float y;
+    float velX;        // pixels per tick
+    float velY;
+    float radius;
+};
+
+// ===================== Snapshot ===========================================================
+
+struct Snapshot {
+    long tick = 0;
+    int score = 0;
+    int lives = 0;
+    bool gameOver = false;
+
+    // Ship (velocity is 0 unless it is flying)
+    SpaceObjType shipType = SHIP;
+    double shipX = 0;
+    double shipY = 0;
+    double shipVelX = 0;
+    double shipVelY = 0;
+    double shipRadius = 0;
+    double shipAngle = 0;
+    double shipPrevAngle = 0;
+    bool shipInvincible = false;
+    int shipInvincibleTimer = 0;
+
+    // Asteroids, packed into [0, asteroidCount)
+    int asteroidCount = 0;
+    std::vector<double> asteroidX;
+    std::vector<double> asteroidY;
+    std::vector<double> asteroidVelX;
+    std::vector<double> asteroidVelY;
+    std::vector<double> asteroidRadius;
+    std::vector<unsigned char> asteroidShape;
+
+    // Photons, packed into [0, photonCount)
+    int photonCount = 0;
+    std::vector<double> photonX;
+    std::vector<double> photonY;
+    std::vector<double> photonVelX;
+    std::vector<double> photonVelY;
+    std::vector<double> photonRadius;
+
+    // Effects numbered [effectCount - EFFECT_HISTORY, effectCount), each at its number % EFFECT_HISTORY
+    long effectCount = 0;
+    Effect effects[EFFECT_HISTORY] = {};
+
+    // Sim thread timings, so the render thread can show them without reading the sim's Profiler
+    double simPhaseMs[PHASE_COUNT] = {};
+    FrameStats simTickStats = {};
+
+    // When this tick was due on the sim thread's clock, used to interpolate toward the next one
+    std::chrono::steady_clock::time_point publishedAt;
+
+    /**
+     * Sizes every array once so filling a snapshot never allocates.
+     *
+     * @param asteroidCapacity Most asteroids a tick can have
+     * @param photonCapacity Most photons a tick can have
+     */
+    explicit Snapshot(int asteroidCapacity = MAX_ASTEROIDS, int photonCapacity = MAX_PHOTONS) {
+        reserve(asteroidCapacity, photonCapacity);
+    }
+
+    /**
+     * Grows the arrays to hold at least this many entities (only allocates when the World has grown).
+     *
+     * @param asteroidCapacity Most asteroids a tick can have
+     * @param photonCapacity Most photons a tick can have
+     */
+    void reserve(int asteroidCapacity, int photonCapacity) {
+        if (static_cast<int>(asteroidX.size()) < asteroidCapacity) {
+            asteroidX.resize(asteroidCapacity);
+            asteroidY.resize(asteroidCapacity);
+            asteroidVelX.resize(asteroidCapacity);
+            asteroidVelY.resize(asteroidCapacity);
+            asteroidRadius.resize(asteroidCapacity);
+            asteroidShape.resize(asteroidCapacity);
+        }
+
+        if (static_cast<int>(photonX.size()) < photonCapacity) {
+            photonX.resize(photonCapacity);
+            photonY.resize(photonCapacity);
+            photonVelX.resize(photonCapacity);
+            photonVelY.resize(photonCapacity);
+            photonRadius.resize(photonCapacity);
+        }
+    }
+};
+
+#endif
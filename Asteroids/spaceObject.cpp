@@ -49,24 +49,23 @@ SpaceObject::SpaceObject(SpaceObjType type, Point location, Point velocity,
     setRadius(radius);
 }
 
-void SpaceObject::generateAsteroidShape() {
+void SpaceObject::generateAsteroidShape(Pcg32& rng) {
 
-    vertices.clear();
+    // Reuses the same buffer when an asteroid is reshaped
+    vertices.resize(ASTEROID_POINTS);
 
-    const int POINT_COUNT = 12;
+    for (int i = 0; i < ASTEROID_POINTS; i++) {
 
-    for (int i = 0; i < POINT_COUNT; i++) {
-
-        float angleDeg = (360.f / POINT_COUNT) * i;
+        float angleDeg = (360.f / ASTEROID_POINTS) * i;
         float angleRad = angleDeg * 3.14159265f / 180.f;
 
-        float variation = 0.8f + static_cast<float>(std::rand()) / RAND_MAX * 0.4f;
+        float variation = 0.8f + static_cast<float>(rng.nextDouble()) * 0.4f;
         float r = static_cast<float>(radius) * variation;
 
         float x = std::cos(angleRad) * r;
         float y = std::sin(angleRad) * r;
 
-        vertices.push_back(sf::Vector2f(x, y));
+        vertices[i] = sf::Vector2f(x, y);
     }
 }
 
@@ -124,9 +123,6 @@ void SpaceObject::applyThrust(float thrustAmount) {
     double speed = std::sqrt(velocity.x * velocity.x +
                          velocity.y * velocity.y);
 
-    // Cap the speed to avoid going mach jesus off the screen into an asteroid.
-    double MAX_SPEED = 3.0;
-
     if (speed > MAX_SPEED) {
         velocity.x = (velocity.x / speed) * MAX_SPEED;
         velocity.y = (velocity.y / speed) * MAX_SPEED;
@@ -160,8 +156,8 @@ void SpaceObject::updatePosition() {
         return;
 
     if (type == SHIP_EXPLODING) {
-        radius += 0.8;
-        if (radius >= 40.0)
+        radius += SHIP_EXPLOSION_GROWTH;
+        if (radius >= SHIP_RADIUS + SHIP_EXPLOSION_GROWTH * SHIP_EXPLOSION_TICKS)
             type = SHIP_GONE;
         return;
     }
@@ -207,7 +203,7 @@ void SpaceObject::draw(sf::RenderWindow& window) {
         sf::CircleShape shipShape(static_cast<float>(radius));
         // Pulse alpha if invincible
         if (invincible) {
-            // invincibleTimer counts down from 180 -> 0
+            // invincibleTimer counts down from SHIP_INVINCIBLE_TICKS -> 0
             float t = static_cast<float>(invincibleTimer) * 0.25f;
             int alpha = static_cast<int>(128 + std::sin(t) * 127);
             if (alpha < 30) alpha = 30;   // keep it visible
@@ -310,7 +306,7 @@ int SpaceObject::getTimesDrawn() const {
 void SpaceObject::setInvincible(bool value) {
     invincible = value;
     if (value) {
-        invincibleTimer = 180;
+        invincibleTimer = SHIP_INVINCIBLE_TICKS;
     }
 }
 
@@ -11,6 +11,7 @@
 #ifndef SPACEOBJECT_H
 #define SPACEOBJECT_H
 #include "constants.h"
+#include "random.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
 
@@ -181,7 +182,12 @@ class SpaceObject {
 
     bool isInvincible() const;
 
-    void generateAsteroidShape();
+    /**
+     * Builds a jagged outline for draw(), each point 80-120% of the radius.
+     *
+     * @param rng Generator to draw the variation from
+    */
+    void generateAsteroidShape(Pcg32& rng);
 
 };
 #endif
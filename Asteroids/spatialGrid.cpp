@@ -0,0 +1,66 @@
+/*
+*   File: spatialGrid.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Uniform grid broadphase that wraps around the screen edges the same way objects do.
+*/
+
+#include "spatialGrid.h"
+#include <algorithm>
+
+/**
+ * Cells divide the screen exactly; at least 3 per axis so the 3x3 block never visits a cell twice
+ */
+SpatialGrid::SpatialGrid(double minCellSize) {
+    cols = std::max(3, static_cast<int>(SCREEN_WIDTH / minCellSize));
+    rows = std::max(3, static_cast<int>(SCREEN_HEIGHT / minCellSize));
+
+    cellWidth = static_cast<double>(SCREEN_WIDTH) / cols;
+    cellHeight = static_cast<double>(SCREEN_HEIGHT) / rows;
+
+    cellStart.assign(cols * rows + 1, 0);
+    cursor.assign(cols * rows, 0);
+}
+
+int SpatialGrid::cellIndex(double x, double y) const {
+    int cx = static_cast<int>(x / cellWidth);
+    int cy = static_cast<int>(y / cellHeight);
+
+    cx = std::min(std::max(cx, 0), cols - 1);
+    cy = std::min(std::max(cy, 0), rows - 1);
+
+    return cy * cols + cx;
+}
+
+void SpatialGrid::reserve(int capacity) {
+    if (static_cast<int>(entries.size()) < capacity) {
+        entries.resize(capacity);
+        cellOf.resize(capacity);
+    }
+}
+
+/**
+ * Counting sort by cell: count, prefix sum, scatter
+ */
+void SpatialGrid::build(const double* x, const double* y, int count) {
+    reserve(count);
+
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+
+    for (int i = 0; i < count; i++) {
+        int c = cellIndex(x[i], y[i]);
+        cellOf[i] = c;
+        cellStart[c + 1]++;
+    }
+
+    for (int c = 0; c < cols * rows; c++) {
+        cellStart[c + 1] += cellStart[c];
+        cursor[c] = cellStart[c];
+    }
+
+    for (int i = 0; i < count; i++) {
+        entries[cursor[cellOf[i]]++] = i;
+    }
+}
@@ -0,0 +1,95 @@
+/*
+*   File: spatialGrid.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Uniform grid broadphase that wraps around the screen edges the same way objects do. Rebuilt every
+*   tick with a counting sort, then queried for the handful of entities near a point.
+*
+*/
+
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+#include "constants.h"
+#include <vector>
+
+class SpatialGrid {
+    private:
+
+    int cols;
+    int rows;
+    double cellWidth;
+    double cellHeight;
+
+    // Entity indices sorted by cell, cell c owns entries[cellStart[c], cellStart[c + 1])
+    std::vector<int> cellStart;
+    std::vector<int> cursor;
+    std::vector<int> entries;
+    std::vector<int> cellOf;
+
+    int cellIndex(double x, double y) const;
+
+    public:
+
+    /**
+     * Splits the screen into equal cells at least minCellSize wide and tall.
+     * A query only looks one cell out, so minCellSize must be at least the largest radius sum tested.
+     *
+     * @param minCellSize Smallest allowed cell size in pixels
+    */
+    explicit SpatialGrid(double minCellSize);
+
+    /**
+     * Sizes the bucket arrays up front so build() never allocates for up to capacity entities.
+     *
+     * @param capacity Most entities that will be built at once
+    */
+    void reserve(int capacity);
+
+    /**
+     * Buckets count entities by the cell their center falls in.
+     *
+     * @param x Packed x coordinates, all in [0, SCREEN_WIDTH)
+     * @param y Packed y coordinates, all in [0, SCREEN_HEIGHT)
+     * @param count Number of entities
+    */
+    void build(const double* x, const double* y, int count);
+
+    /**
+     * Entity indices from the last build(), grouped by cell with cells in row order (a permutation of [0, count)).
+     * Moving the entities into this order puts neighbours in space next to each other in memory.
+     *
+     * @return count indices
+    */
+    const int* getEntries() const { return entries.data(); }
+
+    /**
+     * Calls visit(index) for every entity in the 3x3 block of cells around (x, y), wrapping at the screen edges.
+     * Every entity within minCellSize of the point is visited exactly once, in no particular order.
+     *
+     * @param x Query x coordinate
+     * @param y Query y coordinate
+     * @param visit Callback taking the entity index
+    */
+    template <typename Visitor>
+    void forEachNear(double x, double y, Visitor visit) const {
+        int c = cellIndex(x, y);
+        int cx = c % cols;
+        int cy = c / cols;
+
+        for (int oy = -1; oy <= 1; oy++) {
+            int ny = (cy + oy + rows) % rows;
+
+            for (int ox = -1; ox <= 1; ox++) {
+                int nc = ny * cols + (cx + ox + cols) % cols;
+
+                for (int k = cellStart[nc]; k < cellStart[nc + 1]; k++) {
+                    visit(entries[k]);
+                }
+            }
+        }
+    }
+
+};
+#endif
@@ -0,0 +1,182 @@
+/*
+*   File: sweepAndPrune.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Incremental sweep-and-prune broadphase for asteroid vs asteroid tests.
+*/
+
+#include "sweepAndPrune.h"
+#include <algorithm>
+
+/**
+ * List order: by where the interval starts, ties by handle so it is a total order
+ */
+static bool sweepLess(const SweepEntry& a, const SweepEntry& b) {
+    if (a.min != b.min) return a.min < b.min;
+    return a.handle < b.handle;
+}
+
+SweepAndPrune::SweepAndPrune() {
+    bandStart.assign(SWEEP_BANDS + 1, 0);
+    bandCursor.assign(SWEEP_BANDS, 0);
+}
+
+void SweepAndPrune::reserve(int capacity) {
+    entries.reserve(capacity);
+    firstBand.reserve(capacity);
+    secondBand.reserve(capacity);
+
+    // Every asteroid in up to two bands
+    sweepMin.reserve(capacity * 2);
+    sweepMax.reserve(capacity * 2);
+    sweepY.reserve(capacity * 2);
+    sweepRadius.reserve(capacity * 2);
+    sweepFirst.reserve(capacity * 2);
+    sweepIndex.reserve(capacity * 2);
+    if (static_cast<int>(overlaps.size()) < capacity * 2) {
+        overlaps.resize(capacity * 2);
+    }
+    if (static_cast<int>(listedAs.size()) < capacity) {
+        listedAs.resize(capacity, NO_ENTITY);
+    }
+}
+
+void SweepAndPrune::clear() {
+    entries.clear();
+    dealBands();
+    std::fill(listedAs.begin(), listedAs.end(), NO_ENTITY);
+}
+
+/**
+ * Three passes: refresh and compact the list in place, append what isn't listed yet, sort
+ */
+void SweepAndPrune::update(const AsteroidStore& asteroids) {
+    // The store may have grown since the last tick
+    reserve(asteroids.capacity());
+
+    const double* ax = asteroids.getX();
+    const double* ay = asteroids.getY();
+    const double* ar = asteroids.getRadii();
+
+    // 1) Keep order, drop the dead, pick up where everyone moved
+    int kept = 0;
+    for (const SweepEntry& old : entries) {
+        int i = asteroids.find(old.handle);
+        if (i < 0) {
+            listedAs[old.handle & ENTITY_SLOT_MASK] = NO_ENTITY;
+            continue;
+        }
+
+        SweepEntry& e = entries[kept++];
+        e.handle = old.handle;
+        e.index = i;
+        e.min = ax[i] - ar[i];
+        e.max = ax[i] + ar[i];
+        e.y = ay[i];
+        e.radius = ar[i];
+    }
+    entries.resize(kept);
+
+    // 2) New since last time (spawned, split, or a slot reused by a new asteroid)
+    int added = 0;
+    for (int i = 0; i < asteroids.size(); i++) {
+        EntityHandle h = asteroids.getHandle(i);
+        if (listedAs[asteroids.getSlot(i)] == h)
+            continue;
+
+        listedAs[asteroids.getSlot(i)] = h;
+        entries.push_back({ax[i] - ar[i], ax[i] + ar[i], ay[i], ar[i], i, h});
+        added++;
+    }
+
+    // 3) Coherent tick: almost sorted already. Otherwise the insertion sort would go quadratic.
+    if (added * 8 > kept) {
+        std::sort(entries.begin(), entries.end(), sweepLess);
+    } else {
+        insertionSort();
+    }
+
+    dealBands();
+}
+
+/**
+ * Each entry only walks back past the ones it overtook since the last tick
+ */
+void SweepAndPrune::insertionSort() {
+    int n = static_cast<int>(entries.size());
+
+    for (int k = 1; k < n; k++) {
+        if (!sweepLess(entries[k], entries[k - 1]))
+            continue;
+
+        SweepEntry moving = entries[k];
+        int j = k;
+        while (j > 0 && sweepLess(moving, entries[j - 1])) {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+        entries[j] = moving;
+    }
+}
+
+/**
+ * Counting sort by band (count, prefix sum, scatter), which keeps each band in list order
+ */
+void SweepAndPrune::dealBands() {
+    int n = static_cast<int>(entries.size());
+    firstBand.resize(n);
+    secondBand.resize(n);
+    std::fill(bandStart.begin(), bandStart.end(), 0);
+
+    for (int k = 0; k < n; k++) {
+        const SweepEntry& e = entries[k];
+        double top = e.y - e.radius;
+        if (top < 0) top += SCREEN_HEIGHT;
+
+        int first = std::min(static_cast<int>(top / SWEEP_BAND_HEIGHT), SWEEP_BANDS - 1);
+
+        // Reaches into the next band down (wrapping to the top)
+        bool spansTwo = top + 2 * e.radius >= (first + 1) * SWEEP_BAND_HEIGHT;
+
+        firstBand[k] = first;
+        secondBand[k] = spansTwo ? (first + 1) % SWEEP_BANDS : -1;
+
+        bandStart[first + 1]++;
+        if (spansTwo) {
+            bandStart[secondBand[k] + 1]++;
+        }
+    }
+
+    for (int c = 0; c < SWEEP_BANDS; c++) {
+        bandStart[c + 1] += bandStart[c];
+        bandCursor[c] = bandStart[c];
+    }
+
+    int total = bandStart[SWEEP_BANDS];
+    sweepMin.resize(total);
+    sweepMax.resize(total);
+    sweepY.resize(total);
+    sweepRadius.resize(total);
+    sweepFirst.resize(total);
+    sweepIndex.resize(total);
+
+    for (int k = 0; k < n; k++) {
+        const SweepEntry& e = entries[k];
+        int bands[2] = {firstBand[k], secondBand[k]};
+
+        for (int c : bands) {
+            if (c < 0)
+                continue;
+
+            int at = bandCursor[c]++;
+            sweepMin[at] = e.min;
+            sweepMax[at] = e.max;
+            sweepY[at] = e.y;
+            sweepRadius[at] = e.radius;
+            sweepFirst[at] = firstBand[k];
+            sweepIndex[at] = e.index;
+        }
+    }
+}
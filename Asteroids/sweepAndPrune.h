@@ -0,0 +1,165 @@
+/*
+*   File: sweepAndPrune.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Incremental sweep-and-prune broadphase for asteroid vs asteroid tests. Every asteroid is an interval
+*   on the x axis, kept in one list sorted by where it starts. Asteroids only move a few pixels a tick, so last tick's
+*   list is already almost sorted and an insertion sort puts it right in about one pass. The sorted list is then dealt
+*   out, still in order, into horizontal bands of the screen, and a sweep along each band finds every pair whose
+*   intervals overlap without ever looking at pairs that are far apart (bands keep asteroids at opposite ends of the
+*   screen vertically from counting as overlapping on x). Entries are kept by handle, so the list survives asteroids
+*   being removed, split or reordered in the store between ticks.
+*
+*/
+
+#ifndef SWEEPANDPRUNE_H
+#define SWEEPANDPRUNE_H
+#include "constants.h"
+#include "entityStore.h"
+#include <cmath>
+#include <vector>
+
+// Horizontal bands the sweep is split into. Every asteroid must fit in two bands (at most a band tall), the same
+// limit GRID_CELL_SIZE puts on the grid.
+const int SWEEP_BANDS = static_cast<int>(SCREEN_HEIGHT / GRID_CELL_SIZE);
+const double SWEEP_BAND_HEIGHT = static_cast<double>(SCREEN_HEIGHT) / SWEEP_BANDS;
+
+/**
+ * One asteroid's place in the list, with what the sort and the sweep need copied out of the store by update().
+ */
+struct SweepEntry {
+    double min;                 // x - radius, may be below 0 near the left edge
+    double max;                 // x + radius, may be past SCREEN_WIDTH near the right edge
+    double y;
+    double radius;
+    int index;                  // index in the store as of the last update()
+    EntityHandle handle;
+};
+
+class SweepAndPrune {
+    private:
+
+    // Sorted by (min, handle), so the order never depends on what order the asteroids were added in
+    std::vector<SweepEntry> entries;
+
+    // The sorted list dealt into bands as packed arrays: band c owns [bandStart[c], bandStart[c + 1]), in list order.
+    // An asteroid is in every band its y extent touches (one or two).
+    std::vector<int> bandStart;
+    std::vector<int> bandCursor;
+    std::vector<int> firstBand;           // per list entry: the band its y extent starts in
+    std::vector<int> secondBand;          // and the one it reaches into, -1 for none
+    std::vector<double> sweepMin;
+    std::vector<double> sweepMax;
+    std::vector<double> sweepY;
+    std::vector<double> sweepRadius;
+    std::vector<int> sweepFirst;          // the asteroid's first band
+    std::vector<int> sweepIndex;
+
+    // Band positions that passed the y test for the entry being swept
+    std::vector<int> overlaps;
+
+    // Handle listed for each store slot (NO_ENTITY for none), to spot asteroids that are new since the last update
+    std::vector<EntityHandle> listedAs;
+
+    void insertionSort();
+    void dealBands();
+
+    /**
+     * Collects the entries in [begin, end) of band c whose y extent overlaps entry k's into overlaps, with no
+     * branch per entry. A pair that shares two bands is only taken in the first, so it comes out once: in band c
+     * exactly when c is one of the two asteroids' first band.
+     *
+     * @return How many were collected
+    */
+    int gatherOverlapsOnY(int c, int k, int begin, int end) {
+        double yk = sweepY[k];
+        double rk = sweepRadius[k];
+        bool kFirst = sweepFirst[k] == c;
+        int found = 0;
+
+        for (int j = begin; j < end; j++) {
+            double dy = std::fabs(yk - sweepY[j]);
+            dy = dy > SCREEN_HEIGHT / 2.0 ? SCREEN_HEIGHT - dy : dy;
+            overlaps[found] = j;
+            found += (dy <= rk + sweepRadius[j]) & (kFirst | (sweepFirst[j] == c));
+        }
+        return found;
+    }
+
+    public:
+
+    SweepAndPrune();
+
+    /**
+     * Sizes the list up front so update() never allocates for up to capacity asteroids.
+     *
+     * @param capacity Most asteroids that will be listed at once
+    */
+    void reserve(int capacity);
+
+    /**
+     * Brings the list up to date with the store: drops asteroids that are gone, refreshes the rest from their
+     * handles, appends new ones, and re-sorts. An insertion sort when only a few are new (nearly sorted, close to
+     * linear), a full sort when a lot are (a new game, a load).
+     *
+     * @param asteroids Live asteroids
+    */
+    void update(const AsteroidStore& asteroids);
+
+    /**
+     * Empties the list, so the next update() rebuilds it from scratch.
+    */
+    void clear();
+
+    /**
+     * Calls visit(a, b) once for every pair of listed asteroids whose bounding boxes overlap, measured across the
+     * screen wrap (so every pair of circles that touch is visited, plus some near misses at the corners).
+     * Pairs come in a fixed order for a given state: band by band, along the sorted list, then the pairs that meet
+     * across the left/right edge.
+     *
+     * @param visit Callback taking the two store indices
+    */
+    template <typename Visitor>
+    void forEachPair(Visitor visit) {
+        const double* lo = sweepMin.data();
+        const double* hi = sweepMax.data();
+        const int* index = sweepIndex.data();
+
+        for (int c = 0; c < SWEEP_BANDS; c++) {
+            int begin = bandStart[c];
+            int end = bandStart[c + 1];
+
+            // Straight along the axis: everything after k that starts before k ends overlaps it on x
+            for (int k = begin; k < end; k++) {
+                int last = k + 1;
+                while (last < end && lo[last] <= hi[k]) last++;
+
+                int found = gatherOverlapsOnY(c, k, k + 1, last);
+                for (int f = 0; f < found; f++) {
+                    visit(index[k], index[overlaps[f]]);
+                }
+            }
+
+            // Across the edge: k sticks out past the right edge by reach, so it meets whatever starts within reach
+            // of 0
+            for (int k = begin; k < end; k++) {
+                double reach = hi[k] - SCREEN_WIDTH;
+                int last = begin;
+                while (last < k && lo[last] <= reach) last++;
+
+                int found = gatherOverlapsOnY(c, k, begin, last);
+                for (int f = 0; f < found; f++) {
+                    visit(index[overlaps[f]], index[k]);
+                }
+            }
+        }
+    }
+
+    // ===================== Accessors(Getters) ===========================================
+
+    int size() const { return static_cast<int>(entries.size()); }
+
+};
+#endif
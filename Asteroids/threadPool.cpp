@@ -0,0 +1,172 @@
+/*
+*   File: threadPool.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Fixed set of worker threads for data-parallel loops, with range stealing between threads.
+*/
+
+#include "threadPool.h"
+#include <algorithm>
+
+static std::uint64_t packRange(int begin, int end) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(begin)) << 32) | static_cast<std::uint32_t>(end);
+}
+
+static int rangeBegin(std::uint64_t bounds) { return static_cast<int>(bounds >> 32); }
+static int rangeEnd(std::uint64_t bounds) { return static_cast<int>(bounds & 0xFFFFFFFFu); }
+
+/**
+ * 0 means one thread per hardware thread
+ */
+static int resolveThreadCount(int threads) {
+    if (threads > 0)
+        return threads;
+
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+ThreadPool::ThreadPool(int threads) : ranges(resolveThreadCount(threads)) {
+    threads = static_cast<int>(ranges.size());
+
+    jobFn = nullptr;
+    jobContext = nullptr;
+    jobGrain = 1;
+    generation = 0;
+    pendingWorkers = 0;
+    stopping = false;
+
+    for (WorkRange& r : ranges) {
+        r.bounds.store(0, std::memory_order_relaxed);
+    }
+
+    for (int i = 1; i < threads; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (std::thread& t : workers) {
+        t.join();
+    }
+}
+
+int ThreadPool::getThreadCount() const {
+    return static_cast<int>(workers.size()) + 1;
+}
+
+/**
+ * Take the back half (or the last item) of another thread's slice and make it our own
+ */
+bool ThreadPool::steal(int slot) {
+    int threads = static_cast<int>(ranges.size());
+
+    for (int k = 1; k < threads; k++) {
+        WorkRange& victim = ranges[(slot + k) % threads];
+        std::uint64_t bounds = victim.bounds.load(std::memory_order_acquire);
+
+        for (;;) {
+            int begin = rangeBegin(bounds);
+            int end = rangeEnd(bounds);
+            if (begin >= end)
+                break;
+
+            int mid = begin + (end - begin) / 2;
+            if (victim.bounds.compare_exchange_weak(bounds, packRange(begin, mid), std::memory_order_acq_rel)) {
+                ranges[slot].bounds.store(packRange(mid, end), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Own slice from the front a chunk at a time, then steal until nothing is left anywhere
+ */
+void ThreadPool::runChunks(int slot) {
+    WorkRange& own = ranges[slot];
+
+    do {
+        std::uint64_t bounds = own.bounds.load(std::memory_order_acquire);
+
+        for (;;) {
+            int begin = rangeBegin(bounds);
+            int end = rangeEnd(bounds);
+            if (begin >= end)
+                break;
+
+            int chunkEnd = std::min(begin + jobGrain, end);
+            if (own.bounds.compare_exchange_weak(bounds, packRange(chunkEnd, end), std::memory_order_acq_rel)) {
+                jobFn(jobContext, begin, chunkEnd);
+                bounds = own.bounds.load(std::memory_order_acquire);
+            }
+        }
+    } while (steal(slot));
+}
+
+void ThreadPool::workerLoop(int slot) {
+    long seen = 0;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+        }
+
+        runChunks(slot);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pendingWorkers == 0) {
+            finished.notify_one();
+        }
+    }
+}
+
+/**
+ * Small jobs (or a single thread) run inline; otherwise split the range, wake the workers, help out, and wait
+ */
+void ThreadPool::run(int count, int grain, void (*fn)(void*, int, int), void* context) {
+    if (count <= 0)
+        return;
+
+    grain = std::max(grain, 1);
+    if (workers.empty() || count <= grain) {
+        fn(context, 0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobFn = fn;
+        jobContext = context;
+        jobGrain = grain;
+
+        int threads = static_cast<int>(ranges.size());
+        for (int t = 0; t < threads; t++) {
+            int begin = static_cast<int>(static_cast<long long>(count) * t / threads);
+            int end = static_cast<int>(static_cast<long long>(count) * (t + 1) / threads);
+            ranges[t].bounds.store(packRange(begin, end), std::memory_order_relaxed);
+        }
+
+        pendingWorkers = static_cast<int>(workers.size());
+        generation++;
+    }
+    wake.notify_all();
+
+    runChunks(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&]() { return pendingWorkers == 0; });
+}
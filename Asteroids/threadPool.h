@@ -0,0 +1,95 @@
+/*
+*   File: threadPool.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Fixed set of worker threads for data-parallel loops, with work stealing. parallelFor gives every
+*   thread (workers and the caller) an equal slice of [0, count). Each thread eats its own slice from the front a chunk
+*   at a time; a thread that runs out steals the back half of another thread's slice, so uneven chunks still finish
+*   together.
+*
+*/
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+#include <atomic>
+#include <cstdint>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+    private:
+
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+
+    // Remaining part of one thread's slice, begin in the high 32 bits and end in the low 32 bits, so the owner taking
+    // from the front and a thief taking from the back both update it with one compare-and-swap
+    struct alignas(64) WorkRange {
+        std::atomic<std::uint64_t> bounds;
+    };
+
+    // Current job, type erased so parallelFor never allocates
+    void (*jobFn)(void*, int, int);
+    void* jobContext;
+    int jobGrain;
+    std::vector<WorkRange> ranges;   // one per thread, the caller is slot 0
+
+    long generation;      // bumped for every job, workers wait for it to change
+    int pendingWorkers;   // workers still inside the current job
+    bool stopping;
+
+    template <typename Body>
+    static void invokeBody(void* context, int begin, int end) {
+        (*static_cast<Body*>(context))(begin, end);
+    }
+
+    void run(int count, int grain, void (*fn)(void*, int, int), void* context);
+    void runChunks(int slot);
+    bool steal(int slot);
+    void workerLoop(int slot);
+
+    public:
+
+    /**
+     * Starts threads - 1 workers; the thread calling parallelFor is the last one.
+     *
+     * @param threads Total threads to use, 0 for one per hardware thread
+    */
+    explicit ThreadPool(int threads = 0);
+
+    /**
+     * Wakes and joins every worker.
+    */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @return Threads that work on a parallelFor, counting the caller
+    */
+    int getThreadCount() const;
+
+    /**
+     * Calls body(begin, end) over disjoint chunks covering [0, count) and returns when all of them are done.
+     * Chunks run in no particular order and on any thread, so body must only touch its own range.
+     * Not reentrant: body must not call parallelFor on the same pool.
+     *
+     * @param count Number of items
+     * @param grain Items per chunk (at least 1)
+     * @param body Callable taking (int begin, int end)
+    */
+    template <typename Body>
+    void parallelFor(int count, int grain, Body body) {
+        run(count, grain, &invokeBody<Body>, &body);
+    }
+
+};
+#endif
@@ -0,0 +1,260 @@
+/*
+*   File: timerWheel.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Hierarchical timer wheel counted in ticks.
+*/
+
+#include "timerWheel.h"
+#include <cstring>
+
+TimerWheel::TimerWheel(int capacity) {
+    timers.reserve(capacity);
+    clear();
+}
+
+void TimerWheel::reserve(int capacity) {
+    timers.reserve(capacity);
+}
+
+void TimerWheel::clear() {
+    timers.clear();
+    freeHead = -1;
+    liveCount = 0;
+    now = 0;
+
+    for (int level = 0; level < WHEEL_LEVELS; level++) {
+        for (int s = 0; s < WHEEL_SLOTS; s++) {
+            head[level][s] = -1;
+            tail[level][s] = -1;
+        }
+    }
+}
+
+/**
+ * Appends to the finest level that reaches the due tick, so each slot fires in scheduling order
+ */
+void TimerWheel::link(int id) {
+    Timer& t = timers[id];
+    long delta = t.due - now;
+
+    // Beyond the horizon: park in the last slot level 2 reaches, it is re-placed when that slot cascades
+    long horizon = (1L << (WHEEL_BITS * WHEEL_LEVELS)) - 1;
+    long placeAt = delta > horizon ? now + horizon : t.due;
+
+    int level = 0;
+    while (level < WHEEL_LEVELS - 1 && delta >= (1L << (WHEEL_BITS * (level + 1)))) {
+        level++;
+    }
+    int s = static_cast<int>((placeAt >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1));
+
+    t.prev = tail[level][s];
+    t.next = -1;
+    if (t.prev >= 0) {
+        timers[t.prev].next = id;
+    } else {
+        head[level][s] = id;
+    }
+    tail[level][s] = id;
+
+    t.level = level;
+    t.slot = s;
+}
+
+void TimerWheel::unlink(int id) {
+    Timer& t = timers[id];
+    int level = t.level;
+    int s = t.slot;
+
+    if (t.prev >= 0) {
+        timers[t.prev].next = t.next;
+    } else {
+        head[level][s] = t.next;
+    }
+
+    if (t.next >= 0) {
+        timers[t.next].prev = t.prev;
+    } else {
+        tail[level][s] = t.prev;
+    }
+}
+
+/**
+ * Re-places every timer in the level's current slot, now that they are close enough for a finer level
+ */
+void TimerWheel::cascade(int level) {
+    int s = static_cast<int>((now >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1));
+    int id = head[level][s];
+
+    head[level][s] = -1;
+    tail[level][s] = -1;
+
+    while (id >= 0) {
+        int next = timers[id].next;
+        link(id);
+        id = next;
+    }
+}
+
+/**
+ * Unlinks and frees the oldest timer due on this tick, or returns -1 when there are none left
+ */
+int TimerWheel::popDue() {
+    int id = head[0][now & (WHEEL_SLOTS - 1)];
+    if (id < 0)
+        return -1;
+
+    unlink(id);
+
+    Timer& t = timers[id];
+    t.live = 0;
+    t.next = freeHead;
+    freeHead = id;
+    liveCount--;
+    return id;
+}
+
+int TimerWheel::schedule(long delay, int kind, int target) {
+    int id;
+    if (freeHead >= 0) {
+        id = freeHead;
+        freeHead = timers[id].next;
+    } else {
+        id = static_cast<int>(timers.size());
+        timers.push_back({});
+    }
+
+    Timer& t = timers[id];
+    t.due = now + (delay < 1 ? 1 : delay);
+    t.kind = kind;
+    t.target = target;
+    t.live = 1;
+    liveCount++;
+
+    link(id);
+    return id;
+}
+
+void TimerWheel::cancel(int id) {
+    if (!timers[id].live)
+        return;
+
+    unlink(id);
+
+    Timer& t = timers[id];
+    t.live = 0;
+    t.next = freeHead;
+    freeHead = id;
+    liveCount--;
+}
+
+// ============================================================
+// Save / restore
+// ============================================================
+
+/**
+ * Block header ahead of the slot lists and the pool
+ */
+struct WheelSaveHeader {
+    std::int64_t now;
+    std::int32_t freeHead;
+    std::int32_t liveCount;
+    std::int32_t poolSize;
+    std::int32_t timerBytes;    // sizeof(Timer) when written, the pool is only readable with the same layout
+};
+
+static const std::size_t WHEEL_LIST_BYTES = 2 * WHEEL_LEVELS * WHEEL_SLOTS * sizeof(int);
+
+std::size_t TimerWheel::getSaveBytes() const {
+    std::size_t bytes = sizeof(WheelSaveHeader) + WHEEL_LIST_BYTES + timers.size() * sizeof(Timer);
+    return (bytes + 7) & ~static_cast<std::size_t>(7);
+}
+
+void TimerWheel::saveTo(unsigned char* out) const {
+    WheelSaveHeader header;
+    header.now = now;
+    header.freeHead = freeHead;
+    header.liveCount = liveCount;
+    header.poolSize = static_cast<std::int32_t>(timers.size());
+    header.timerBytes = static_cast<std::int32_t>(sizeof(Timer));
+
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    std::memcpy(out, head, sizeof(head));
+    out += sizeof(head);
+    std::memcpy(out, tail, sizeof(tail));
+    out += sizeof(tail);
+    std::memcpy(out, timers.data(), timers.size() * sizeof(Timer));
+}
+
+/**
+ * Everything is checked in place, so a bad block is turned down before anything is copied
+ */
+bool TimerWheel::isSaveValid(const unsigned char* in, std::size_t bytes) {
+    WheelSaveHeader header;
+    if (bytes < sizeof(header) + WHEEL_LIST_BYTES)
+        return false;
+    std::memcpy(&header, in, sizeof(header));
+
+    if (header.timerBytes != static_cast<std::int32_t>(sizeof(Timer)) || header.poolSize < 0 ||
+        header.liveCount < 0 || header.liveCount > header.poolSize ||
+        sizeof(header) + WHEEL_LIST_BYTES + static_cast<std::size_t>(header.poolSize) * sizeof(Timer) > bytes)
+        return false;
+
+    // The header and lists are a multiple of 8 bytes, so the lists and the pool are aligned within the block
+    const int* lists = reinterpret_cast<const int*>(in + sizeof(header));
+    const Timer* pool = reinterpret_cast<const Timer*>(in + sizeof(header) + WHEEL_LIST_BYTES);
+    int poolSize = header.poolSize;
+
+    // Every link has to land inside the pool, or the first advance() would walk off the end, and every live flag
+    // has to be 0 or 1
+    bool linksOk = header.freeHead >= -1 && header.freeHead < poolSize;
+    for (int k = 0; k < 2 * WHEEL_LEVELS * WHEEL_SLOTS; k++) {
+        linksOk = linksOk && lists[k] >= -1 && lists[k] < poolSize;
+    }
+    for (int id = 0; id < poolSize; id++) {
+        const Timer& t = pool[id];
+        linksOk = linksOk && t.live <= 1 && t.prev >= -1 && t.prev < poolSize && t.next >= -1 && t.next < poolSize &&
+                  (!t.live || (t.level >= 0 && t.level < WHEEL_LEVELS && t.slot >= 0 && t.slot < WHEEL_SLOTS));
+    }
+    return linksOk;
+}
+
+bool TimerWheel::findSavedTimer(const unsigned char* in, int id, int& kind, int& target) {
+    WheelSaveHeader header;
+    std::memcpy(&header, in, sizeof(header));
+
+    if (id < 0 || id >= header.poolSize)
+        return false;
+
+    const Timer& t = reinterpret_cast<const Timer*>(in + sizeof(header) + WHEEL_LIST_BYTES)[id];
+    if (!t.live)
+        return false;
+
+    kind = t.kind;
+    target = t.target;
+    return true;
+}
+
+bool TimerWheel::loadFrom(const unsigned char* in, std::size_t bytes) {
+    if (!isSaveValid(in, bytes))
+        return false;
+
+    WheelSaveHeader header;
+    std::memcpy(&header, in, sizeof(header));
+
+    const int* lists = reinterpret_cast<const int*>(in + sizeof(header));
+    const Timer* pool = reinterpret_cast<const Timer*>(in + sizeof(header) + WHEEL_LIST_BYTES);
+    int poolSize = header.poolSize;
+
+    std::memcpy(head, lists, sizeof(head));
+    std::memcpy(tail, lists + WHEEL_LEVELS * WHEEL_SLOTS, sizeof(tail));
+    timers.assign(pool, pool + poolSize);
+
+    now = header.now;
+    freeHead = header.freeHead;
+    liveCount = header.liveCount;
+    return true;
+}
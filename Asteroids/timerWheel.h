@@ -0,0 +1,173 @@
+/*
+*   File: timerWheel.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Hierarchical timer wheel counted in ticks. Timers are scheduled a number of ticks ahead and fire on
+*   that tick; advancing one tick only touches the timers that are due (plus one cascade from a coarser level every
+*   WHEEL_SLOTS ticks), so the cost of a tick follows the number of events, not the number of live objects.
+*
+*/
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Three levels of 64 slots: level 0 holds the next 64 ticks, level 1 the next 64 * 64, level 2 the next 64^3.
+// Anything further out waits in level 2 and is re-placed when its slot comes round.
+const int WHEEL_BITS = 6;
+const int WHEEL_SLOTS = 1 << WHEEL_BITS;
+const int WHEEL_LEVELS = 3;
+
+class TimerWheel {
+    private:
+
+    // One pending timer, linked into its slot's list in scheduling order
+    struct Timer {
+        long due;
+        int kind;
+        int target;
+        int prev;
+        int next;
+        int level;     // where it is linked, so unlink doesn't have to work it out again
+        int slot;
+        std::uint8_t live;    // 0 or 1. Not a bool: saves are read in place, and any byte in one must be safe to test
+    };
+
+    std::vector<Timer> timers;    // pool, reused through the free list
+    int freeHead;
+    int liveCount;
+    long now;
+
+    int head[WHEEL_LEVELS][WHEEL_SLOTS];
+    int tail[WHEEL_LEVELS][WHEEL_SLOTS];
+
+    void link(int id);
+    void unlink(int id);
+    void cascade(int level);
+    int popDue();
+
+    public:
+
+    /**
+     * Empty wheel at tick 0.
+     *
+     * @param capacity Timers that can be pending before the pool has to grow
+    */
+    explicit TimerWheel(int capacity = 0);
+
+    /**
+     * Makes room for this many pending timers, so scheduling never allocates below it.
+     *
+     * @param capacity Timers that can be pending at once
+    */
+    void reserve(int capacity);
+
+    /**
+     * Drops every pending timer and sets the clock back to tick 0.
+    */
+    void clear();
+
+    /**
+     * Schedules a timer.
+     *
+     * @param delay Ticks from now, at least 1 (fires on the advance that reaches now + delay)
+     * @param kind What to do when it fires, up to the caller
+     * @param target What it applies to, up to the caller (an index, say)
+     * @return Timer id, valid until the timer fires or is cancelled
+    */
+    int schedule(long delay, int kind, int target);
+
+    /**
+     * Removes a pending timer.
+     *
+     * @param id Timer from schedule() that has not fired yet
+    */
+    void cancel(int id);
+
+    /**
+     * @param id Timer from schedule() that has not fired yet
+     * @return Ticks left until it fires (1 = on the next advance)
+    */
+    long getRemaining(int id) const { return timers[id].due - now; }
+
+    /**
+     * @return Timers still pending
+    */
+    int size() const { return liveCount; }
+
+    // ===================== Save / restore ====================================================
+
+    /**
+     * @return Bytes saveTo() writes (a multiple of 8)
+    */
+    std::size_t getSaveBytes() const;
+
+    /**
+     * Copies the clock, every slot list and the whole timer pool (free slots included) out as they are, so a
+     * loaded wheel fires the same timers in the same order as this one would.
+     *
+     * @param out At least getSaveBytes() bytes, 8 byte aligned
+    */
+    void saveTo(unsigned char* out) const;
+
+    /**
+     * Checks that a saveTo() block fits this build's layout, every link in it lands inside its pool and every timer
+     * is either pending or free.
+     *
+     * @param in Block written by saveTo(), 8 byte aligned
+     * @param bytes Size of the block
+     * @return True if loadFrom() will take it
+    */
+    static bool isSaveValid(const unsigned char* in, std::size_t bytes);
+
+    /**
+     * Looks up one timer in a saveTo() block without loading it, so what a save's timer ids point at can be checked
+     * first.
+     *
+     * @param in Block passed by isSaveValid()
+     * @param id Timer id to look up, any value
+     * @param kind Set to the timer's kind if it is pending
+     * @param target Set to the timer's target if it is pending
+     * @return True if id is a pending timer in the block
+    */
+    static bool findSavedTimer(const unsigned char* in, int id, int& kind, int& target);
+
+    /**
+     * Replaces the wheel with one written by saveTo().
+     *
+     * @param in Block written by saveTo(), 8 byte aligned
+     * @param bytes Size of the block
+     * @return False (wheel unchanged) if isSaveValid() turns the block down
+    */
+    bool loadFrom(const unsigned char* in, std::size_t bytes);
+
+    /**
+     * Moves the clock forward one tick and fires everything due on it, oldest scheduled first.
+     * fire may schedule and cancel other timers while it runs.
+     *
+     * @param fire Called as fire(kind, target) for each timer that fires
+    */
+    template <typename Fire>
+    void advance(Fire fire) {
+        now++;
+
+        // Coarser levels empty into finer ones as their slot comes round, outermost first
+        if ((now & (WHEEL_SLOTS - 1)) == 0) {
+            if (((now >> WHEEL_BITS) & (WHEEL_SLOTS - 1)) == 0) {
+                cascade(2);
+            }
+            cascade(1);
+        }
+
+        int id;
+        while ((id = popDue()) >= 0) {
+            fire(timers[id].kind, timers[id].target);
+        }
+    }
+
+};
+#endif
@@ -0,0 +1,164 @@
+/*
+*   File: timing.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Fixed timestep accumulator and a hybrid sleep/spin frame pacer with jitter statistics.
+*/
+
+#include "timing.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+// ============================================================
+// FixedStep
+// ============================================================
+
+FixedStep::FixedStep(double stepSeconds, int maxSteps) {
+    this->stepSeconds = stepSeconds;
+    this->maxSteps = maxSteps;
+    accumulator = 0;
+    droppedSteps = 0;
+}
+
+int FixedStep::advance(double elapsedSeconds) {
+    accumulator += std::max(elapsedSeconds, 0.0);
+
+    int steps = static_cast<int>(accumulator / stepSeconds);
+    accumulator -= steps * stepSeconds;
+
+    if (steps > maxSteps) {
+        droppedSteps += steps - maxSteps;
+        steps = maxSteps;
+    }
+
+    return steps;
+}
+
+double FixedStep::getLeftoverSeconds() const {
+    return accumulator;
+}
+
+double FixedStep::getAlpha() const {
+    return accumulator / stepSeconds;
+}
+
+long FixedStep::getDroppedSteps() const {
+    return droppedSteps;
+}
+
+// ============================================================
+// FramePacer
+// ============================================================
+
+FramePacer::FramePacer(double rate) {
+    started = false;
+    historyCount = 0;
+    historyNext = 0;
+
+    // Start by assuming a 1ms sleep can take 2ms, the estimate adapts after a few frames
+    sleepEstimate = 2e-3;
+    sleepMean = 1e-3;
+    sleepM2 = 0;
+    sleepCount = 0;
+
+    setRate(rate);
+}
+
+void FramePacer::setRate(double rate) {
+    targetSeconds = rate > 0 ? 1.0 / rate : 0.0;
+    started = false;
+}
+
+double FramePacer::getTargetMs() const {
+    return targetSeconds * 1000.0;
+}
+
+/**
+ * Sleep in 1ms steps while that is safe, then spin. Every sleep updates the estimate, so a coarse OS timer
+ * (15.6ms on a default Windows scheduler) just means more spinning instead of missed frames.
+ */
+void FramePacer::sleepUntil(Clock::time_point target) {
+    for (;;) {
+        double remaining = std::chrono::duration<double>(target - Clock::now()).count();
+        if (remaining <= sleepEstimate)
+            break;
+
+        Clock::time_point before = Clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        double slept = std::chrono::duration<double>(Clock::now() - before).count();
+
+        sleepCount++;
+        double delta = slept - sleepMean;
+        sleepMean += delta / sleepCount;
+        sleepM2 += delta * (slept - sleepMean);
+        double stdDev = sleepCount > 1 ? std::sqrt(sleepM2 / (sleepCount - 1)) : 0.0;
+        sleepEstimate = sleepMean + stdDev;
+    }
+
+    while (Clock::now() < target) {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::wait() {
+    Clock::time_point now = Clock::now();
+
+    if (targetSeconds > 0) {
+        Clock::duration interval = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(targetSeconds));
+
+        if (!started) {
+            deadline = now + interval;
+        } else {
+            deadline += interval;
+            if (now - deadline > interval) {
+                deadline = now;
+            }
+        }
+
+        sleepUntil(deadline);
+        now = Clock::now();
+    }
+
+    if (started) {
+        intervalMs[historyNext] = std::chrono::duration<double, std::milli>(now - lastFrame).count();
+        historyNext = (historyNext + 1) % PACER_HISTORY;
+        if (historyCount < PACER_HISTORY) historyCount++;
+    }
+
+    lastFrame = now;
+    started = true;
+}
+
+JitterStats FramePacer::getJitterStats() const {
+    JitterStats stats = {0, 0, 0, 0, 0};
+    if (historyCount == 0)
+        return stats;
+
+    double total = 0;
+    for (int i = 0; i < historyCount; i++) {
+        total += intervalMs[i];
+    }
+    stats.frames = historyCount;
+    stats.meanMs = total / historyCount;
+
+    // Unlimited pacing has no target, so deviation is measured from the mean instead
+    double targetMs = targetSeconds > 0 ? targetSeconds * 1000.0 : stats.meanMs;
+
+    double variance = 0;
+    double deviations[PACER_HISTORY];
+    for (int i = 0; i < historyCount; i++) {
+        double d = intervalMs[i] - stats.meanMs;
+        variance += d * d;
+        deviations[i] = std::fabs(intervalMs[i] - targetMs);
+    }
+    stats.stdDevMs = std::sqrt(variance / historyCount);
+
+    std::sort(deviations, deviations + historyCount);
+    stats.p99DeviationMs = deviations[std::min(historyCount - 1, (historyCount * 99) / 100)];
+    stats.maxDeviationMs = deviations[historyCount - 1];
+    return stats;
+}
@@ -0,0 +1,129 @@
+/*
+*   File: timing.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Fixed timestep accumulator and a high precision frame pacer. FixedStep turns wall clock time into a
+*   whole number of simulation ticks, so gameplay speed never depends on frame rate. FramePacer waits for the next
+*   frame deadline with coarse sleeps followed by a short spin, and measures how far each frame lands from its target.
+*
+*/
+
+#ifndef TIMING_H
+#define TIMING_H
+#include <chrono>
+
+// Most ticks FixedStep runs to catch up after a stall, anything beyond that is dropped
+const int MAX_CATCHUP_TICKS = 5;
+
+// Frame intervals kept for the jitter statistics
+const int PACER_HISTORY = 240;
+
+// ===================== FixedStep ==========================================================
+
+class FixedStep {
+    private:
+
+    double stepSeconds;
+    double accumulator;
+    int maxSteps;
+    long droppedSteps;
+
+    public:
+
+    /**
+     * @param stepSeconds Length of one tick
+     * @param maxSteps Most ticks a single advance() may ask for
+    */
+    FixedStep(double stepSeconds, int maxSteps);
+
+    /**
+     * Adds elapsed wall clock time and takes out as many whole ticks as fit.
+     * A backlog longer than maxSteps is dropped instead of fast-forwarded.
+     *
+     * @param elapsedSeconds Time since the last call
+     * @return Number of ticks to run now
+    */
+    int advance(double elapsedSeconds);
+
+    /**
+     * @return Time left in the accumulator, less than one tick
+    */
+    double getLeftoverSeconds() const;
+
+    /**
+     * @return How far into the next tick the accumulator is, in [0, 1)
+    */
+    double getAlpha() const;
+
+    /**
+     * @return Total ticks dropped because of stalls
+    */
+    long getDroppedSteps() const;
+
+};
+
+// ===================== FramePacer =========================================================
+
+struct JitterStats {
+    int frames;
+    double meanMs;            // average frame interval
+    double stdDevMs;          // spread of the interval
+    double p99DeviationMs;    // 99th percentile of |interval - target|
+    double maxDeviationMs;
+};
+
+class FramePacer {
+    private:
+
+    typedef std::chrono::steady_clock Clock;
+
+    double targetSeconds;
+    Clock::time_point deadline;
+    Clock::time_point lastFrame;
+    bool started;
+
+    // Running estimate of how long sleep_for(1ms) really takes (mean + one std dev, Welford)
+    double sleepEstimate;
+    double sleepMean;
+    double sleepM2;
+    long sleepCount;
+
+    double intervalMs[PACER_HISTORY];
+    int historyCount;
+    int historyNext;
+
+    void sleepUntil(Clock::time_point target);
+
+    public:
+
+    /**
+     * @param rate Frames per second to pace to, 0 for no limit (wait() only measures)
+    */
+    explicit FramePacer(double rate);
+
+    /**
+     * @param rate Frames per second to pace to, 0 for no limit
+    */
+    void setRate(double rate);
+
+    /**
+     * @return Target interval in milliseconds (0 if unlimited)
+    */
+    double getTargetMs() const;
+
+    /**
+     * Blocks until the next frame deadline, then records the interval since the previous wait().
+     * Sleeps while the deadline is further away than the sleep estimate and spins the rest. If a frame ran more
+     * than a whole interval late the schedule restarts from now rather than rushing to catch up.
+    */
+    void wait();
+
+    /**
+     * @return Interval statistics over the last PACER_HISTORY frames (all 0 before the second frame)
+    */
+    JitterStats getJitterStats() const;
+
+};
+#endif
@@ -0,0 +1,74 @@
+/*
+*   File: tripleBuffer.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Lock-free triple buffer for one writer thread and one reader thread. The writer always has a slot of
+*   its own to fill, the reader always has a stable slot to read, and the third slot is swapped between them with a
+*   single atomic exchange, so neither side ever waits on the other.
+*
+*/
+
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+#include <atomic>
+
+template <typename T>
+class TripleBuffer {
+    private:
+
+    // The middle slot index lives in the low bits, FRESH_BIT is set while it holds a value the reader has not taken
+    static const int INDEX_MASK = 3;
+    static const int FRESH_BIT = 4;
+
+    T slots[3];
+    std::atomic<int> middle;
+
+    int back;    // writer only
+    int front;   // reader only
+
+    public:
+
+    TripleBuffer() : middle(1), back(0), front(2) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // ===================== Writer ============================================================
+
+    /**
+     * @return Slot the writer fills next (never read by the reader until publish())
+    */
+    T& getBack() { return slots[back]; }
+
+    /**
+     * Hands the filled back slot to the reader and takes the old middle slot as the new back slot.
+     * If the reader never picked up the previous value it is simply overwritten.
+    */
+    void publish() {
+        back = middle.exchange(back | FRESH_BIT, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    // ===================== Reader ============================================================
+
+    /**
+     * Takes the newest published value, if there is one.
+     *
+     * @return True if getFront() changed
+    */
+    bool update() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+            return false;
+
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @return Newest value taken by update(), stays valid until the next update()
+    */
+    const T& getFront() const { return slots[front]; }
+
+};
+#endif
@@ -0,0 +1,759 @@
+/*
+*   File: world.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Window-free simulation core for the Asteroids clone. Same rules that used to live in main(): thrust,
+*   torpedos with a lifetime, splitting asteroids, scoring, lives, respawn and invincibility.
+*/
+
+#include "world.h"
+#include "saveState.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// ============================================================
+// Part 1 Required Helper Functions
+// ============================================================
+
+/**
+ * Random location on screen
+ */
+Point getRandomLocation(Pcg32& rng) {
+    Point p;
+    p.x = rng.nextBelow(SCREEN_WIDTH);
+    p.y = rng.nextBelow(SCREEN_HEIGHT);
+    return p;
+}
+
+/**
+ * Random velocity in [-1, 1], in steps of 0.01
+ */
+Point getRandomVelocity(Pcg32& rng) {
+    int rx = rng.nextInt(-100, 100);
+    int ry = rng.nextInt(-100, 100);
+
+    Point v;
+    v.x = rx / 100.0;
+    v.y = ry / 100.0;
+    return v;
+}
+
+// ============================================================
+// World setup / teardown
+// ============================================================
+
+WorldConfig makeStressConfig(int asteroidCount) {
+    WorldConfig config;
+    config.asteroidCapacity = asteroidCount * 2;
+    config.photonCapacity = 16 * (PHOTON_LIFESPAN + 1);
+    config.startingAsteroids = asteroidCount;
+    config.photonsPerFire = 16;
+    config.shipInvulnerable = true;
+    config.asteroidSortInterval = ASTEROID_SORT_INTERVAL;
+    return config;
+}
+
+World::World(unsigned seed, const WorldConfig& config)
+    : config(config), spawnRng(seed, STREAM_SPAWN), shapeRng(seed, STREAM_SHAPE), splitRng(seed, STREAM_SPLIT),
+      asteroids(config.asteroidCapacity, true), photons(config.photonCapacity), asteroidGrid(GRID_CELL_SIZE) {
+
+    sizeScratch();
+
+    tick = 0;
+    profiler = nullptr;
+    pool = nullptr;
+    shipExplodedAt = 0;
+    effectCount = 0;
+    reset();
+}
+
+World::~World() {
+    destroyAll();
+}
+
+/**
+ * Collision scratch, photon timers and the grid, sized for the current config (again after a load)
+ */
+void World::sizeScratch() {
+    hits.reserve(config.photonCapacity);
+    asteroidHit.assign(asteroids.capacity(), 0);
+    candidates.resize(config.photonCapacity);
+    photonHit.assign(config.photonCapacity, 0);
+    sweptEvents.reserve(config.photonCapacity * 4);
+    photonTimer.assign(config.photonCapacity, -1);
+    timers.reserve(config.photonCapacity + 2);
+    asteroidGrid.reserve(asteroids.capacity());
+    asteroidSweep.reserve(asteroids.capacity());
+}
+
+/**
+ * Empty both stores
+ */
+void World::destroyAll() {
+    asteroids.clear();
+    photons.clear();
+    timers.clear();
+    asteroidSweep.clear();
+    std::fill(photonTimer.begin(), photonTimer.end(), -1);
+    invincibilityTimer = -1;
+}
+
+void World::reset() {
+    score = 0;
+    lives = 3;
+    gameOver = false;
+
+    destroyAll();
+    spawnStartingAsteroids();
+    resetShip();
+}
+
+/**
+ * New asteroid drawn with a random outline from the shape library
+ *
+ * @return Index of the asteroid, or -1 if the store is full
+ */
+int World::spawnAsteroid(Point location, Point velocity, double r) {
+    int i = asteroids.add(location, velocity, r);
+    if (i >= 0) {
+        asteroids.setShape(i, shapeRng.nextBelow(ASTEROID_SHAPES));
+    }
+    return i;
+}
+
+/**
+ * Creates the starting asteroids (5 in a normal game)
+ */
+void World::spawnStartingAsteroids() {
+    for (int i = 0; i < config.startingAsteroids; i++) {
+        Point p = getRandomLocation(spawnRng);
+        Point v = getRandomVelocity(spawnRng);
+
+        spawnAsteroid(p, v, 25.0);
+    }
+}
+
+/**
+ * Fresh ship in the middle of the screen, facing right (reset in place, no allocation)
+ */
+void World::resetShip() {
+    ship = ShipState();
+    ship.location = {SCREEN_WIDTH / 2.0, SCREEN_HEIGHT / 2.0};
+}
+
+// ============================================================
+// Game tick
+// ============================================================
+
+void World::step(const InputFrame& input) {
+    tick++;
+
+    {
+        ScopedTimer timer(profiler, PHASE_CONTROLS);
+
+        // ---------------------
+        // 1) Fire / restart
+        // ---------------------
+        if (input.fire && ship.type == SHIP) {
+            firePhoton();
+        }
+
+        if (gameOver && input.restart) {
+            reset();
+        }
+
+        // ---------------------
+        // 2) Controls (flying ship only)
+        // ---------------------
+        bool flying = !gameOver && ship.type == SHIP;
+
+        if (flying && input.rotateLeft) {
+            turn<ShipKind>(ship.angle, -ROT_SPEED);
+        }
+        if (flying && input.rotateRight) {
+            turn<ShipKind>(ship.angle, ROT_SPEED);
+        }
+        if (flying && input.thrust) {
+            // A float, as SpaceObject::applyThrust has always taken it, so recordings still replay
+            thrust<ShipKind>(ship.angle, 0.7f, ship.velocity.x, ship.velocity.y);
+        }
+    }
+
+    // ---------------------
+    // 3) Asteroid bounces
+    // ---------------------
+    // Before anything moves, from where last tick left everything, so the velocity an asteroid has after a step
+    // is always the step it took (the renderer rewinds along it)
+    if (config.asteroidBounce) {
+        ScopedTimer timer(profiler, PHASE_COLLISIONS);
+        handleAsteroidBounces();
+    }
+
+    // ---------------------
+    // 4) Update positions
+    // ---------------------
+    {
+        ScopedTimer timer(profiler, PHASE_UPDATE);
+        updatePositions();
+    }
+
+    // ---------------------
+    // 5) Collisions
+    // ---------------------
+    {
+        ScopedTimer timer(profiler, PHASE_COLLISIONS);
+
+        asteroidGrid.build(asteroids.getX(), asteroids.getY(), asteroids.size());
+
+        if (config.asteroidSortInterval > 0 && tick % config.asteroidSortInterval == 0) {
+            sortAsteroids();
+        }
+
+        handleShipCollisions();
+        handlePhotonCollisions();
+    }
+}
+
+/**
+ * Launches torpedos from the ship (one, or a fan in stress mode), as many as the store has room for
+ */
+void World::firePhoton() {
+    for (int k = 0; k < config.photonsPerFire; k++) {
+        int i = photons.add(ship.location,
+                            ship.velocity,
+                            2.0,
+                            ship.angle + k * (360.0 / config.photonsPerFire));
+        if (i < 0)
+            break;
+
+        photons.applyThrust(i, 5.0);
+
+        // The wheel advances later this tick, so one extra tick lands expiry PHOTON_LIFESPAN ticks from now
+        photonTimer[photons.getSlot(i)] = timers.schedule(PHOTON_LIFESPAN + 1, TIMER_PHOTON_EXPIRE,
+                                                          static_cast<int>(photons.getHandle(i)));
+    }
+}
+
+/**
+ * Timers are kept by slot and find their photon by handle, so the photon swapped into i needs nothing
+ */
+void World::removePhoton(int i) {
+    int slot = photons.getSlot(i);
+
+    if (photonTimer[slot] >= 0) {
+        timers.cancel(photonTimer[slot]);
+        photonTimer[slot] = -1;
+    }
+    photons.remove(i);
+}
+
+/**
+ * Puts the asteroids in the order the grid just bucketed them, then rebuilds the grid for the new indices
+ */
+void World::sortAsteroids() {
+    asteroids.reorder(asteroidGrid.getEntries());
+    asteroidGrid.build(asteroids.getX(), asteroids.getY(), asteroids.size());
+}
+
+void World::addEffect(EffectKind kind, Point location, Point velocity, double radius) {
+    Effect& e = effects[effectCount % EFFECT_HISTORY];
+    e.kind = kind;
+    e.x = static_cast<float>(location.x);
+    e.y = static_cast<float>(location.y);
+    e.velX = static_cast<float>(velocity.x);
+    e.velY = static_cast<float>(velocity.y);
+    e.radius = static_cast<float>(radius);
+    effectCount++;
+}
+
+void World::fireTimer(int kind, int target) {
+    switch (kind) {
+        case TIMER_PHOTON_EXPIRE: {
+            // Removed photons cancel their timer, so a stale handle here would be a bug; it is skipped all the same
+            int i = photons.find(static_cast<EntityHandle>(target));
+            if (i >= 0) {
+                photonTimer[photons.getSlot(i)] = -1;
+                removePhoton(i);
+            }
+            break;
+        }
+
+        case TIMER_INVINCIBILITY_END:
+            invincibilityTimer = -1;
+            ship.invincible = false;
+            break;
+
+        case TIMER_SHIP_GONE:
+            ship.type = SHIP_GONE;
+            break;
+    }
+}
+
+int World::getShipInvincibleTicks() const {
+    return invincibilityTimer >= 0 ? static_cast<int>(timers.getRemaining(invincibilityTimer)) : 0;
+}
+
+/**
+ * One branch on the ship's phase, then each store runs its own kernel with nothing to check per entity
+ */
+void World::updatePositions() {
+    switch (ship.type) {
+        case SHIP:
+            advance<ShipKind>(ship);
+            break;
+
+        case SHIP_EXPLODING:
+            advance<ExplosionKind>(ship);
+            ship.radius = explosionRadius<ExplosionKind>(tick - shipExplodedAt);
+            break;
+
+        default:
+            advance<ExplosionKind>(ship);     // gone: only ages
+            break;
+    }
+
+    asteroids.updatePositions();
+    photons.updatePositions();
+
+    // Expiring photons, invincibility running out, the explosion finishing: only what is due this tick
+    timers.advance([this](int kind, int target) { fireTimer(kind, target); });
+
+    // =================================
+    // Respawn Logic
+    // =================================
+    if (ship.type == SHIP_GONE && lives > 0) {
+        lives--;
+        resetShip();
+        ship.invincible = true;
+        invincibilityTimer = timers.schedule(SHIP_INVINCIBLE_TICKS, TIMER_INVINCIBILITY_END, 0);
+    }
+}
+
+/**
+ * Part 2 + Part 3: Ship vs Asteroid -> explode()
+ */
+void World::handleShipCollisions() {
+    if (ship.type != SHIP || ship.invincible || config.shipInvulnerable)
+        return;
+
+    bool hit = config.continuousCollision
+        ? sweepsIntoAnyAsteroid(ship.location, ship.velocity, ship.radius, asteroids, asteroidGrid)
+        : touchesAnyAsteroid(ship.location, ship.radius, asteroids, asteroidGrid);
+
+    if (hit) {
+        addEffect(EFFECT_SHIP_EXPLODE, ship.location, ship.velocity, ship.radius);
+        explode(ship);
+        shipExplodedAt = tick;
+        timers.schedule(SHIP_EXPLOSION_TICKS, TIMER_SHIP_GONE, 0);
+
+        if (lives <= 1) {
+            gameOver = true;
+        }
+    }
+}
+
+/**
+ * Photon vs Asteroid, in two phases:
+ *   1) each photon (in order) claims the lowest indexed asteroid it touches that no earlier photon took
+ *      (with continuousCollision, contacts are claimed in time-of-impact order instead)
+ *   2) claimed asteroids split and score, then hit asteroids and photons are removed from the highest index down
+ * Asteroids split this tick are not in the grid yet, so they can first be hit on the next tick.
+ */
+void World::handlePhotonCollisions() {
+    // The asteroid store may have grown since the last tick
+    if (static_cast<int>(asteroidHit.size()) < asteroids.capacity()) {
+        asteroidHit.resize(asteroids.capacity(), 0);
+    }
+
+    // Below the threshold waking the workers costs more than the pass itself
+    if (config.continuousCollision) {
+        findPhotonHitsSwept(photons, asteroids, asteroidGrid, asteroidHit, photonHit, hits, sweptEvents);
+    } else if (pool != nullptr && pool -> getThreadCount() > 1 && photons.size() >= PARALLEL_PHOTON_THRESHOLD) {
+        findPhotonHitsParallel(photons, asteroids, asteroidGrid, asteroidHit, hits, candidates, *pool);
+    } else {
+        findPhotonHits(photons, asteroids, asteroidGrid, asteroidHit, hits);
+    }
+
+    // Splits can grow the store (and move its arrays), so every hit reads through the store. Hit indices stay
+    // valid: new asteroids only ever go on the end.
+    for (const PhotonHit& h : hits) {
+
+        double oldRadius = asteroids.getRadius(h.asteroid);
+        Point hitLocation = asteroids.getLocation(h.asteroid);
+
+        addEffect(EFFECT_ASTEROID_BREAK, hitLocation, asteroids.getVelocity(h.asteroid), oldRadius);
+
+        // If asteroid large enough -> split
+        if (oldRadius > 6.25) {
+            for (int created = 0; created < 2; created++) {
+                Point v = getRandomVelocity(splitRng);
+                spawnAsteroid(hitLocation, {v.x * 2, v.y * 2}, oldRadius / 2.0);
+            }
+        }
+
+        // Calculate Score
+        if (oldRadius == 25.0) {
+            score += 10;
+        } else if (oldRadius == 12.5) {
+            score += 20;
+        } else {
+            score += 40;
+        }
+    }
+
+    // Flags for the asteroids just split off (never hit)
+    if (static_cast<int>(asteroidHit.size()) < asteroids.size()) {
+        asteroidHit.resize(asteroids.size(), 0);
+    }
+
+    // Highest index first so swap-remove only ever moves entities that survive
+    for (int a = asteroids.size() - 1; a >= 0; a--) {
+        if (asteroidHit[a]) {
+            asteroidHit[a] = 0;
+            asteroids.remove(a);
+        }
+    }
+
+    for (int k = static_cast<int>(hits.size()) - 1; k >= 0; k--) {
+        removePhoton(hits[k].photon);
+    }
+}
+
+/**
+ * Asteroid vs Asteroid: every touching pair that is closing bounces. Only velocities change (no pushing apart),
+ * so overlapping asteroids drift out of each other on their own over the next few ticks. Runs at the start of a
+ * tick on last tick's positions (asteroids split last tick included).
+ * Pairs are resolved in the sweep's order, which only depends on the state, so the result replays exactly.
+ */
+void World::handleAsteroidBounces() {
+    const double* ar = asteroids.getRadii();
+
+    asteroidSweep.update(asteroids);
+
+    asteroidSweep.forEachPair([&](int a, int b) {
+        Point va = asteroids.getVelocity(a);
+        Point vb = asteroids.getVelocity(b);
+
+        if (bounceCircles(asteroids.getLocation(a), va, ar[a], asteroids.getLocation(b), vb, ar[b])) {
+            asteroids.setVelocity(a, va);
+            asteroids.setVelocity(b, vb);
+        }
+    });
+}
+
+// ============================================================
+// Snapshot (read by the render thread)
+// ============================================================
+
+void World::capture(Snapshot& out) const {
+    out.tick = tick;
+    out.score = score;
+    out.lives = lives;
+    out.gameOver = gameOver;
+
+    Point velocity = ship.type == SHIP ? ship.velocity : Point{0.0, 0.0};
+    out.shipType = ship.type;
+    out.shipX = ship.location.x;
+    out.shipY = ship.location.y;
+    out.shipVelX = velocity.x;
+    out.shipVelY = velocity.y;
+    out.shipRadius = ship.radius;
+    out.shipAngle = ship.angle;
+    out.shipInvincible = ship.invincible;
+    out.shipInvincibleTimer = getShipInvincibleTicks();
+
+    out.reserve(asteroids.capacity(), photons.capacity());
+
+    out.asteroidCount = asteroids.size();
+    for (int i = 0; i < asteroids.size(); i++) {
+        Point v = asteroids.getVelocity(i);
+        out.asteroidX[i] = asteroids.getX()[i];
+        out.asteroidY[i] = asteroids.getY()[i];
+        out.asteroidVelX[i] = v.x;
+        out.asteroidVelY[i] = v.y;
+        out.asteroidRadius[i] = asteroids.getRadius(i);
+        out.asteroidShape[i] = static_cast<unsigned char>(asteroids.getShape(i));
+    }
+
+    out.photonCount = photons.size();
+    for (int i = 0; i < photons.size(); i++) {
+        Point v = photons.getVelocity(i);
+        out.photonX[i] = photons.getX()[i];
+        out.photonY[i] = photons.getY()[i];
+        out.photonVelX[i] = v.x;
+        out.photonVelY[i] = v.y;
+        out.photonRadius[i] = photons.getRadius(i);
+    }
+
+    // Only what this snapshot hasn't had yet, and never more than the history holds
+    long first = std::max(out.effectCount, effectCount - EFFECT_HISTORY);
+    for (long e = first; e < effectCount; e++) {
+        out.effects[e % EFFECT_HISTORY] = effects[e % EFFECT_HISTORY];
+    }
+    out.effectCount = effectCount;
+}
+
+// ============================================================
+// State hash (replay verification)
+// ============================================================
+
+/**
+ * FNV-1a style mix, one 64-bit word at a time; doubles go in by bit pattern so any drift shows up
+ */
+static void hashWord(std::uint64_t& h, std::uint64_t word) {
+    h ^= word;
+    h *= 1099511628211ULL;
+    h ^= h >> 32;
+}
+
+static void hashDouble(std::uint64_t& h, double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    hashWord(h, bits);
+}
+
+/**
+ * Hashes the fields a kind doesn't store as the 0 they used to hold, so hashes (and recordings) match earlier builds
+ */
+template <typename Kind>
+static void hashStore(std::uint64_t& h, const EntityStore<Kind>& store) {
+    hashWord(h, static_cast<std::uint64_t>(store.size()));
+
+    for (int i = 0; i < store.size(); i++) {
+        Point v = store.getVelocity(i);
+
+        hashDouble(h, store.getX()[i]);
+        hashDouble(h, store.getY()[i]);
+        hashDouble(h, v.x);
+        hashDouble(h, v.y);
+        hashDouble(h, store.getRadius(i));
+        hashDouble(h, store.getAngle(i));
+        hashWord(h, (static_cast<std::uint64_t>(store.getAge(i)) << 16) |
+                    (static_cast<std::uint64_t>(Kind::type) << 8) |
+                    static_cast<std::uint64_t>(store.getShape(i)));
+    }
+}
+
+std::uint64_t World::stateHash() const {
+    std::uint64_t h = 14695981039346656037ULL;
+
+    hashWord(h, static_cast<std::uint64_t>(tick));
+    hashWord(h, static_cast<std::uint64_t>(score));
+    hashWord(h, (static_cast<std::uint64_t>(lives) << 1) | (gameOver ? 1 : 0));
+
+    hashDouble(h, ship.location.x);
+    hashDouble(h, ship.location.y);
+    hashDouble(h, ship.velocity.x);
+    hashDouble(h, ship.velocity.y);
+    hashDouble(h, ship.radius);
+    hashDouble(h, ship.angle);
+    hashWord(h, static_cast<std::uint64_t>(ship.type));
+    hashWord(h, static_cast<std::uint64_t>(ship.age));
+    hashWord(h, (static_cast<std::uint64_t>(getShipInvincibleTicks()) << 1) | (ship.invincible ? 1 : 0));
+
+    hashStore(h, asteroids);
+    hashStore(h, photons);
+
+    hashWord(h, spawnRng.getState());
+    hashWord(h, shapeRng.getState());
+    hashWord(h, splitRng.getState());
+    return h;
+}
+
+// ============================================================
+// Save / restore
+// ============================================================
+
+void World::save(std::vector<unsigned char>& out) const {
+    SaveHeader header;
+    std::memset(&header, 0, sizeof(header));
+
+    header.magic[0] = 'A';
+    header.magic[1] = 'S';
+    header.magic[2] = 'A';
+    header.magic[3] = 'V';
+    header.version = SAVE_VERSION;
+    header.byteOrder = SAVE_BYTE_ORDER;
+    header.headerBytes = sizeof(SaveHeader);
+
+    header.asteroidCapacity = config.asteroidCapacity;
+    header.photonCapacity = config.photonCapacity;
+    header.startingAsteroids = config.startingAsteroids;
+    header.photonsPerFire = config.photonsPerFire;
+    header.shipInvulnerable = config.shipInvulnerable ? 1 : 0;
+    header.continuousCollision = config.continuousCollision ? 1 : 0;
+    header.asteroidSortInterval = config.asteroidSortInterval;
+    header.asteroidBounce = config.asteroidBounce ? 1 : 0;
+
+    header.gameOver = gameOver ? 1 : 0;
+    header.score = score;
+    header.lives = lives;
+    header.invincibilityTimer = invincibilityTimer;
+    header.tick = tick;
+    header.shipExplodedAt = shipExplodedAt;
+
+    header.shipX = ship.location.x;
+    header.shipY = ship.location.y;
+    header.shipVelX = ship.velocity.x;
+    header.shipVelY = ship.velocity.y;
+    header.shipRadius = ship.radius;
+    header.shipAngle = ship.angle;
+    header.shipType = ship.type;
+    header.shipAge = ship.age;
+    header.shipInvincible = ship.invincible ? 1 : 0;
+
+    const Pcg32* streams[3] = {&spawnRng, &shapeRng, &splitRng};
+    for (int k = 0; k < 3; k++) {
+        header.rngState[k] = streams[k] -> getState();
+        header.rngIncrement[k] = streams[k] -> getIncrement();
+    }
+
+    header.asteroidCount = asteroids.size();
+    header.asteroidStoreCapacity = asteroids.capacity();
+    header.photonCount = photons.size();
+
+    header.asteroidOffset = sizeof(SaveHeader);
+    header.photonOffset = header.asteroidOffset + AsteroidStore::getSaveBytes(asteroids.size(), asteroids.capacity());
+    header.photonTimerOffset = header.photonOffset + PhotonStore::getSaveBytes(photons.size(), photons.capacity());
+    header.timerOffset = header.photonTimerOffset + alignSave(photons.capacity() * sizeof(int));
+    header.timerBytes = timers.getSaveBytes();
+    header.totalBytes = header.timerOffset + header.timerBytes;
+
+    // Zero filled, so padding is the same in every save of the same state
+    out.assign(header.totalBytes, 0);
+    unsigned char* p = out.data();
+
+    std::memcpy(p, &header, sizeof(header));
+    asteroids.saveTo(p + header.asteroidOffset);
+    photons.saveTo(p + header.photonOffset);
+    std::memcpy(p + header.photonTimerOffset, photonTimer.data(), photons.capacity() * sizeof(int));
+    timers.saveTo(p + header.timerOffset);
+}
+
+/**
+ * Timer ids and the ship are used as they are once loaded, so each must be one this World could have made:
+ * a photon's timer a pending expiry aimed at that slot's photon, the invincibility timer a pending end of
+ * invincibility, the ship in one of its three phases, on the screen, no bigger than its explosion gets
+ */
+static bool savedStateConsistent(const SaveHeader* header, const unsigned char* data) {
+    int type = header -> shipType;
+    if (type != SHIP && type != SHIP_EXPLODING && type != SHIP_GONE)
+        return false;
+
+    if (!isOnScreen({header -> shipX, header -> shipY}) || !isWrappable({header -> shipVelX, header -> shipVelY}) ||
+        !(header -> shipRadius >= SHIP_RADIUS &&
+          header -> shipRadius <= explosionRadius<ExplosionKind>(SHIP_EXPLOSION_TICKS)) ||
+        !std::isfinite(header -> shipAngle))
+        return false;
+
+    const unsigned char* wheel = data + header -> timerOffset;
+    int kind, target;
+
+    if (header -> invincibilityTimer != -1 &&
+        (!TimerWheel::findSavedTimer(wheel, header -> invincibilityTimer, kind, target) ||
+         kind != TIMER_INVINCIBILITY_END))
+        return false;
+
+    std::vector<EntityHandle> photonHandles;
+    PhotonStore::getSavedHandles(data + header -> photonOffset, header -> photonCount, header -> photonCapacity,
+                                 photonHandles);
+    const int* photonTimer = reinterpret_cast<const int*>(data + header -> photonTimerOffset);
+
+    for (int slot = 0; slot < header -> photonCapacity; slot++) {
+        int id = photonTimer[slot];
+        if (id == -1)
+            continue;
+
+        if (photonHandles[slot] == NO_ENTITY || !TimerWheel::findSavedTimer(wheel, id, kind, target) ||
+            kind != TIMER_PHOTON_EXPIRE || target != static_cast<int>(photonHandles[slot]))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Everything is checked before anything is overwritten; after that it is bulk copies and setters
+ */
+bool World::load(const unsigned char* data, std::size_t size) {
+    const SaveHeader* header = findSaveHeader(data, size);
+    if (header == nullptr)
+        return false;
+
+    if (header -> photonCapacity <= 0 || header -> photonCount > header -> photonCapacity ||
+        header -> asteroidStoreCapacity <= 0 || header -> asteroidCount > header -> asteroidStoreCapacity ||
+        header -> photonOffset < header -> asteroidOffset || header -> photonTimerOffset < header -> photonOffset ||
+        header -> photonOffset - header -> asteroidOffset <
+            AsteroidStore::getSaveBytes(header -> asteroidCount, header -> asteroidStoreCapacity) ||
+        header -> photonTimerOffset - header -> photonOffset <
+            PhotonStore::getSaveBytes(header -> photonCount, header -> photonCapacity))
+        return false;
+
+    if (!AsteroidStore::isSaveValid(data + header -> asteroidOffset, header -> asteroidCount,
+                                    header -> asteroidStoreCapacity) ||
+        !PhotonStore::isSaveValid(data + header -> photonOffset, header -> photonCount, header -> photonCapacity))
+        return false;
+
+    if (!TimerWheel::isSaveValid(data + header -> timerOffset, header -> timerBytes) ||
+        !savedStateConsistent(header, data))
+        return false;
+
+    // Checked above, so this can't fail and leave the World half loaded
+    timers.loadFrom(data + header -> timerOffset, header -> timerBytes);
+
+    config.asteroidCapacity = header -> asteroidCapacity;
+    config.photonCapacity = header -> photonCapacity;
+    config.startingAsteroids = header -> startingAsteroids;
+    config.photonsPerFire = header -> photonsPerFire;
+    config.shipInvulnerable = header -> shipInvulnerable != 0;
+    config.continuousCollision = header -> continuousCollision != 0;
+    config.asteroidSortInterval = header -> asteroidSortInterval;
+    config.asteroidBounce = header -> asteroidBounce != 0;
+
+    Pcg32* streams[3] = {&spawnRng, &shapeRng, &splitRng};
+    for (int k = 0; k < 3; k++) {
+        streams[k] -> setState(header -> rngState[k], header -> rngIncrement[k]);
+    }
+
+    asteroids.loadFrom(data + header -> asteroidOffset, header -> asteroidCount, header -> asteroidStoreCapacity);
+    photons.loadFrom(data + header -> photonOffset, header -> photonCount, header -> photonCapacity);
+    asteroidSweep.clear();
+
+    sizeScratch();
+    std::memcpy(photonTimer.data(), data + header -> photonTimerOffset, header -> photonCapacity * sizeof(int));
+
+    ship.location = {header -> shipX, header -> shipY};
+    ship.velocity = {header -> shipVelX, header -> shipVelY};
+    ship.radius = header -> shipRadius;
+    ship.angle = header -> shipAngle;
+    ship.type = static_cast<SpaceObjType>(header -> shipType);
+    ship.age = header -> shipAge;
+    ship.invincible = header -> shipInvincible != 0;
+
+    gameOver = header -> gameOver != 0;
+    score = header -> score;
+    lives = header -> lives;
+    invincibilityTimer = header -> invincibilityTimer;
+    tick = header -> tick;
+    shipExplodedAt = header -> shipExplodedAt;
+    return true;
+}
+
+// ============================================================
+// Getters
+// ============================================================
+
+const ShipState& World::getShip() const { return ship; }
+const AsteroidStore& World::getAsteroids() const { return asteroids; }
+const PhotonStore& World::getPhotons() const { return photons; }
+const WorldConfig& World::getConfig() const { return config; }
+int World::getScore() const { return score; }
+int World::getLives() const { return lives; }
+bool World::isGameOver() const { return gameOver; }
+long World::getTick() const { return tick; }
+long World::getEffectCount() const { return effectCount; }
+
+void World::setProfiler(Profiler* p) { profiler = p; }
+void World::setThreadPool(ThreadPool* p) { pool = p; }
@@ -0,0 +1,292 @@
+/*
+*   File: world.h
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Window-free simulation core for the Asteroids clone. Owns the ship, asteroids, photons, score and lives,
+*   and advances all of it one fixed tick at a time from an InputFrame, so it can run headless or under the SFML front end.
+*
+*/
+
+#ifndef WORLD_H
+#define WORLD_H
+#include "constants.h"
+#include "spaceObject.h"
+#include "kernels.h"
+#include "entityStore.h"
+#include "spatialGrid.h"
+#include "sweepAndPrune.h"
+#include "collision.h"
+#include "profiler.h"
+#include "snapshot.h"
+#include "random.h"
+#include "timerWheel.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ===================== Input ==============================================================
+
+/**
+ * Everything the player can do during a single tick.
+ * fire and restart are edge triggered (a key press this tick), the rest are held keys.
+ */
+struct InputFrame {
+    bool rotateLeft = false;
+    bool rotateRight = false;
+    bool thrust = false;
+    bool fire = false;
+    bool restart = false;
+};
+
+// ===================== Timers =============================================================
+
+/**
+ * What a World timer does when it fires.
+ */
+enum WorldTimer {
+    TIMER_PHOTON_EXPIRE,        // target = photon handle
+    TIMER_INVINCIBILITY_END,
+    TIMER_SHIP_GONE
+};
+
+// ===================== Config =============================================================
+
+/**
+ * Launch-time settings. The defaults are the normal game.
+ */
+struct WorldConfig {
+    // Starting capacities. The asteroid store grows when full, so splits never fail;
+    // the photon store does not, its capacity is the number of torpedos allowed in flight.
+    int asteroidCapacity = MAX_ASTEROIDS;
+    int photonCapacity = MAX_PHOTONS;
+
+    int startingAsteroids = 5;
+
+    // Torpedos launched per shot, fanned evenly around the ship
+    int photonsPerFire = 1;
+
+    // Ship never collides with asteroids (stress testing)
+    bool shipInvulnerable = false;
+
+    // Swept collision tests with time-of-impact ordering, so fast objects can't tunnel through small asteroids
+    bool continuousCollision = false;
+
+    // Every this many ticks the asteroids are put in grid cell order (0 never does). Which asteroid a torpedo
+    // claims depends on the order, so sorted and unsorted games play out differently.
+    int asteroidSortInterval = 0;
+
+    // Asteroids bounce off each other (elastic, mass proportional to radius squared) instead of passing through
+    bool asteroidBounce = false;
+};
+
+/**
+ * Stress test settings: count asteroids, a large torpedo budget, a 16-way fan per shot, an invulnerable ship, and
+ * asteroids sorted by cell every ASTEROID_SORT_INTERVAL ticks.
+ *
+ * @param asteroidCount Asteroids to start with
+ * @return Config for World
+ */
+WorldConfig makeStressConfig(int asteroidCount);
+
+// ===================== Helper Functions ===================================================
+
+/**
+ * Gets a random location within the screen bounds.
+ *
+ * @param rng Generator to draw from
+ * @return Point with x in [0, SCREEN_WIDTH) and y in [0, SCREEN_HEIGHT)
+ */
+Point getRandomLocation(Pcg32& rng);
+
+/**
+ * Gets a random velocity with x and y in [-1, 1].
+ *
+ * @param rng Generator to draw from
+ * @return Point with velocity components in [-1.0, 1.0]
+ */
+Point getRandomVelocity(Pcg32& rng);
+
+// ===================== World ==============================================================
+
+class World {
+    private:
+
+    WorldConfig config;
+
+    // Independent streams, so e.g. an extra split never changes where the next game's asteroids spawn
+    Pcg32 spawnRng;
+    Pcg32 shapeRng;
+    Pcg32 splitRng;
+
+    ShipState ship;
+    AsteroidStore asteroids;
+    PhotonStore photons;
+
+    // Asteroid broadphase, rebuilt every tick after movement
+    SpatialGrid asteroidGrid;
+
+    // Asteroid vs asteroid broadphase, kept from tick to tick (only with asteroidBounce)
+    SweepAndPrune asteroidSweep;
+
+    // Photon collision scratch space, sized once
+    std::vector<PhotonHit> hits;
+    std::vector<char> asteroidHit;
+    std::vector<PhotonCandidates> candidates;
+    std::vector<char> photonHit;
+    std::vector<SweptHit> sweptEvents;
+
+    // Photon lifetimes, invincibility and the explosion, fired by tick instead of polled per object
+    TimerWheel timers;
+    std::vector<int> photonTimer;     // expiry timer of the photon in each slot
+    int invincibilityTimer;           // -1 when not invincible
+    long shipExplodedAt;
+
+    int score;
+    int lives;
+    bool gameOver;
+    long tick;
+
+    // Breaks and explosions for the renderer, never read back by the simulation (not hashed, not saved)
+    Effect effects[EFFECT_HISTORY];
+    long effectCount;
+
+    // Optional, times the controls/update/collision phases of step()
+    Profiler* profiler;
+
+    // Optional, spreads the photon collision pass over its threads once enough photons are in flight
+    ThreadPool* pool;
+
+    void sizeScratch();
+    int spawnAsteroid(Point location, Point velocity, double r);
+    void spawnStartingAsteroids();
+    void resetShip();
+    void destroyAll();
+
+    void firePhoton();
+    void removePhoton(int i);
+    void sortAsteroids();
+    void addEffect(EffectKind kind, Point location, Point velocity, double radius);
+    void fireTimer(int kind, int target);
+    int getShipInvincibleTicks() const;
+    void updatePositions();
+    void handleShipCollisions();
+    void handlePhotonCollisions();
+    void handleAsteroidBounces();
+
+    public:
+
+    /**
+     * Seeds the random streams and sets up a fresh game (ship in the middle, config.startingAsteroids asteroids).
+     *
+     * @param seed Seed for the spawn, shape and split streams
+     * @param config Capacities and stress options
+    */
+    explicit World(unsigned seed = 42, const WorldConfig& config = WorldConfig());
+
+    ~World();
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    /**
+     * Starts a new game: score, lives, asteroids, photons and the ship are all reset.
+     * The random streams are not reseeded, the same as pressing Y after a game over.
+    */
+    void reset();
+
+    /**
+     * Advances the game by exactly one tick.
+     * Runs fire/restart, controls, asteroid bounces, movement, respawn and the collision passes in that order.
+     *
+     * @param input What the player did this tick
+    */
+    void step(const InputFrame& input);
+
+    // ===================== Accessors(Getters) ===========================================
+
+    const ShipState& getShip() const;
+
+    /**
+     * @return Live asteroids, packed into [0, size())
+    */
+    const AsteroidStore& getAsteroids() const;
+
+    /**
+     * @return Live photons, packed into [0, size())
+    */
+    const PhotonStore& getPhotons() const;
+
+    const WorldConfig& getConfig() const;
+
+    int getScore() const;
+    int getLives() const;
+    bool isGameOver() const;
+
+    /**
+     * @return Number of ticks stepped since the World was created
+    */
+    long getTick() const;
+
+    /**
+     * @return Effects emitted since the World was created (the newest EFFECT_HISTORY are kept)
+    */
+    long getEffectCount() const;
+
+    /**
+     * Copies what the renderer needs into a snapshot. Only allocates if the World has outgrown the snapshot.
+     * Effects are copied incrementally, only the ones out has not seen yet.
+     * shipPrevAngle, timings and publishedAt are left for the caller.
+     *
+     * @param out Snapshot to fill
+    */
+    void capture(Snapshot& out) const;
+
+    /**
+     * Hashes everything the simulation depends on (counters, ship, every asteroid and photon, random streams).
+     * Two worlds with the same seed and the same inputs have the same hash on every tick.
+     *
+     * @return 64-bit FNV-1a hash of the current state
+    */
+    std::uint64_t stateHash() const;
+
+    // ===================== Save / restore ==============================================
+
+    /**
+     * Writes the whole game (config, counters, ship, asteroids with their shapes, photons, pending timers and the
+     * random streams) as one flat save block, laid out as in saveState.h. Only allocates if out is too small.
+     *
+     * @param out Replaced with the save
+    */
+    void save(std::vector<unsigned char>& out) const;
+
+    /**
+     * Restores a game written by save(), config included, so stepping on from here gives exactly what the saved
+     * World would have. Any World can load any save, as often as wanted (forking one state into many Worlds).
+     * The profiler and thread pool stay attached.
+     *
+     * @param data Save block (from save() or a MappedFile), 8 byte aligned
+     * @param size Bytes in the block
+     * @return False, with the World unchanged, if the block isn't a save this build can read, or holds a timer id,
+     *         shape, ship phase, position, velocity or size this World could never have written
+    */
+    bool load(const unsigned char* data, std::size_t size);
+
+    /**
+     * Attaches a profiler that times the phases of every step(), or detaches it with nullptr.
+     *
+     * @param p Profiler to record into (not owned)
+    */
+    void setProfiler(Profiler* p);
+
+    /**
+     * Attaches a thread pool for the photon collision pass, or detaches it with nullptr.
+     * Results are identical with or without one, so recordings replay either way.
+     *
+     * @param p Pool to run on (not owned, not shared with anything else calling parallelFor during step())
+    */
+    void setThreadPool(ThreadPool* p);
+
+};
+#endif
@@ -0,0 +1,105 @@
+/*
+*   File: worldTest.cpp
+*   Name: Nick Cully
+*   Version: Part 5
+*   Date: 10/17/2026
+*   Class: CS - 162 - (02)
+*   Description: Headless checks for the World. Plays stress games that start with the asteroid store exactly full,
+*   so the first split of a photon pass grows it while that pass still has hits to handle, and checks after every
+*   tick that the asteroids broken, split and scored all add up. Build it with -fsanitize=address,undefined as well
+*   to catch reads through stale pointers. Exit code 1 on the first failure.
+*
+*/
+
+#include "world.h"
+#include <iostream>
+
+/**
+ * Asteroids of each size, largest first
+ */
+static void countSizes(const AsteroidStore& asteroids, int counts[3]) {
+    counts[0] = counts[1] = counts[2] = 0;
+
+    for (int i = 0; i < asteroids.size(); i++) {
+        double r = asteroids.getRadius(i);
+        if (r == 25.0) {
+            counts[0]++;
+        } else if (r == 12.5) {
+            counts[1]++;
+        } else {
+            counts[2]++;
+        }
+    }
+}
+
+/**
+ * Steps a game with a full asteroid store and a 16-way torpedo fan every tick. A tick's hits are its breaks
+ * (the ship is invulnerable, so every effect is one), and they have to explain both the change in each size and
+ * the change in score.
+ *
+ * @param name Printed with the result
+ * @param config Config to play
+ * @return True if every tick added up and at least one pass grew the store with more hits left to handle
+ */
+static bool checkGrowDuringPhotonPass(const char* name, const WorldConfig& config) {
+    World world(7, config);
+    InputFrame input;
+    input.fire = true;
+    input.rotateRight = true;
+
+    int grownMidPass = 0;
+
+    for (int t = 0; t < 600; t++) {
+        int before[3];
+        countSizes(world.getAsteroids(), before);
+        int capacityBefore = world.getAsteroids().capacity();
+        int scoreBefore = world.getScore();
+        long effectsBefore = world.getEffectCount();
+
+        world.step(input);
+
+        int after[3];
+        countSizes(world.getAsteroids(), after);
+        int hits = static_cast<int>(world.getEffectCount() - effectsBefore);
+
+        // Large hits leave the large count, medium hits the medium count less the halves of the large ones...
+        int largeHits = before[0] - after[0];
+        int mediumHits = before[1] + 2 * largeHits - after[1];
+        int smallHits = before[2] + 2 * mediumHits - after[2];
+
+        if (largeHits < 0 || mediumHits < 0 || smallHits < 0 || largeHits + mediumHits + smallHits != hits ||
+            world.getScore() - scoreBefore != 10 * largeHits + 20 * mediumHits + 40 * smallHits) {
+            std::cout << "FAIL " << name << ": tick " << world.getTick() << " has " << hits << " hits but sizes went "
+                      << before[0] << "/" << before[1] << "/" << before[2] << " -> "
+                      << after[0] << "/" << after[1] << "/" << after[2] << " and score +"
+                      << world.getScore() - scoreBefore << "\n";
+            return false;
+        }
+
+        if (world.getAsteroids().capacity() > capacityBefore && hits >= 2) {
+            grownMidPass++;
+        }
+    }
+
+    if (grownMidPass == 0) {
+        std::cout << "FAIL " << name << ": the store never grew during a pass with more than one hit\n";
+        return false;
+    }
+
+    std::cout << "ok   " << name << " (grew during " << grownMidPass << " passes)\n";
+    return true;
+}
+
+int main() {
+    // Exactly full from the start, and packed so tightly that the first fan hits a dozen asteroids at once: the
+    // first split grows the store with the rest of the hits still to go
+    WorldConfig config = makeStressConfig(2000);
+    config.asteroidCapacity = 2000;
+
+    bool ok = checkGrowDuringPhotonPass("photon pass grows asteroids", config);
+
+    config.continuousCollision = true;
+    ok = checkGrowDuringPhotonPass("swept photon pass grows asteroids", config) && ok;
+
+    return ok ? 0 : 1;
+}